@@ -26,6 +26,12 @@ AddTaskDialog::AddTaskDialog(QWidget *parent) :
 {
     ui->setupUi(this);
     
+    defaultFullScore = 100;
+    defaultTimeLimit = 1000;
+    defaultMemoryLimit = 128;
+    ui->buttonBox->button(QDialogButtonBox::Ok)->setEnabled(false);
+    setWindowTitle(tr("Add Task (Searching...)"));
+    
     ui->fullScore->setValidator(new QIntValidator(1, Settings::upperBoundForFullScore() * 100, this));
     ui->timeLimit->setValidator(new QIntValidator(1, Settings::upperBoundForTimeLimit(), this));
     ui->memoryLimit->setValidator(new QIntValidator(1, Settings::upperBoundForMemoryLimit(), this));
@@ -51,7 +57,38 @@ void AddTaskDialog::addTask(const QString &title, int _fullScore, int _timeLimit
     timeLimit.append(_timeLimit);
     memoryLimit.append(_memoryLimit);
     ui->taskBox->addItem(title);
-    ui->taskBox->setCurrentIndex(0);
+    if (ui->taskBox->count() == 1) ui->taskBox->setCurrentIndex(0);
+    ui->buttonBox->button(QDialogButtonBox::Ok)->setEnabled(true);
+}
+
+void AddTaskDialog::addTask(const QString &title)
+{
+    addTask(title, defaultFullScore, defaultTimeLimit, defaultMemoryLimit);
+}
+
+void AddTaskDialog::setDefaults(int _fullScore, int _timeLimit, int _memoryLimit)
+{
+    defaultFullScore = _fullScore;
+    defaultTimeLimit = _timeLimit;
+    defaultMemoryLimit = _memoryLimit;
+}
+
+void AddTaskDialog::searchFinished()
+{
+    setWindowTitle(tr("Add Task"));
+    if (fullScore.isEmpty()) {
+        reject();
+    }
+}
+
+int AddTaskDialog::getTaskCount() const
+{
+    return ui->taskBox->count();
+}
+
+QString AddTaskDialog::getTaskTitle(int index) const
+{
+    return ui->taskBox->itemText(index);
 }
 
 int AddTaskDialog::getFullScore(int index) const
@@ -84,6 +121,7 @@ int AddTaskDialog::getMemoryLimit(int index) const
 void AddTaskDialog::taskBoxIndexChanged()
 {
     int index = ui->taskBox->currentIndex();
+    if (index == -1) return;
     ui->fullScore->setText(QString("%1").arg(fullScore[index]));
     ui->timeLimit->setText(QString("%1").arg(timeLimit[index]));
     ui->memoryLimit->setText(QString("%1").arg(memoryLimit[index]));
@@ -92,17 +130,20 @@ void AddTaskDialog::taskBoxIndexChanged()
 void AddTaskDialog::fullScoreChanged()
 {
     int index = ui->taskBox->currentIndex();
+    if (index == -1) return;
     fullScore[index] = ui->fullScore->text().toInt();
 }
 
 void AddTaskDialog::timeLimitChanged()
 {
     int index = ui->taskBox->currentIndex();
+    if (index == -1) return;
     timeLimit[index] = ui->timeLimit->text().toInt();
 }
 
 void AddTaskDialog::memoryLimitChanged()
 {
     int index = ui->taskBox->currentIndex();
+    if (index == -1) return;
     memoryLimit[index] = ui->memoryLimit->text().toInt();
 }
@@ -1,436 +1,600 @@
-/***************************************************************************
-    This file is part of Project Lemon
-    Copyright (C) 2011 Zhipeng Jia
-
-    This program is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    This program is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with this program.  If not, see <http://www.gnu.org/licenses/>.
-***************************************************************************/
-
-#include <QMessageBox>
-#include "contest.h"
-#include "task.h"
-#include "testcase.h"
-#include "settings.h"
-#include "compiler.h"
-#include "contestant.h"
-#include "judgingthread.h"
-#include "assignmentthread.h"
-
-Contest::Contest(QObject *parent) :
-    QObject(parent)
-{
-}
-
-void Contest::setSettings(Settings *_settings)
-{
-    settings = _settings;
-}
-
-void Contest::setContestTitle(const QString &title)
-{
-    contestTitle = title;
-}
-
-const QString& Contest::getContestTitle() const
-{
-    return contestTitle;
-}
-
-Task* Contest::getTask(int index) const
-{
-    if (0 <= index && index < taskList.size()) {
-        return taskList[index];
-    } else {
-        return 0;
-    }
-}
-
-const QList<Task*>& Contest::getTaskList() const
-{
-    return taskList;
-}
-
-Contestant* Contest::getContestant(const QString &name) const
-{
-    if (contestantList.contains(name)) {
-        return contestantList.value(name);
-    } else {
-        return 0;
-    }
-}
-
-QList<Contestant*> Contest::getContestantList() const
-{
-    return contestantList.values();
-}
-
-int Contest::getTotalTimeLimit() const
-{
-    int total = 0;
-    for (int i = 0; i < taskList.size(); i ++) {
-        QList<TestCase*> testCaseList = taskList[i]->getTestCaseList();
-        for (int j = 0; j < testCaseList.size(); j ++) {
-            total += testCaseList[j]->getTimeLimit() * testCaseList[j]->getInputFiles().size();
-        }
-    }
-    return total;
-}
-
-void Contest::addTask(Task *task)
-{
-    task->setParent(this);
-    taskList.append(task);
-    connect(task, SIGNAL(problemTitleChanged(QString)),
-            this, SIGNAL(problemTitleChanged()));
-    emit taskAddedForContestant();
-    emit taskAddedForViewer();
-}
-
-void Contest::deleteTask(int index)
-{
-    if (0 <= index && index < taskList.size()) {
-        delete taskList[index];
-        taskList.removeAt(index);
-    }
-    emit taskDeletedForContestant(index);
-    emit taskDeletedForViewer(index);
-}
-
-void Contest::refreshContestantList()
-{
-    QStringList nameList = QDir(Settings::sourcePath()).entryList(QStringList(), QDir::Dirs | QDir::NoDotAndDotDot);
-    QStringList curNameList = contestantList.keys();
-    for (int i = 0; i < curNameList.size(); i ++) {
-        if (! nameList.contains(curNameList[i])) {
-            delete contestantList[curNameList[i]];
-            contestantList.remove(curNameList[i]);
-        }
-    }
-    for (int i = 0; i < nameList.size(); i ++) {
-        if (! contestantList.contains(nameList[i])) {
-            Contestant *newContestant = new Contestant(this);
-            newContestant->setContestantName(nameList[i]);
-            for (int j = 0; j < taskList.size(); j ++) {
-                newContestant->addTask();
-            }
-            contestantList.insert(nameList[i], newContestant);
-            connect(this, SIGNAL(taskAddedForContestant()),
-                    newContestant, SLOT(addTask()));
-            connect(this, SIGNAL(taskDeletedForContestant(int)),
-                    newContestant, SLOT(deleteTask(int)));
-        }
-    }
-}
-
-void Contest::deleteContestant(const QString &name)
-{
-    if (! contestantList.contains(name)) return;
-    delete contestantList[name];
-    contestantList.remove(name);
-}
-
-void Contest::clearPath(const QString &curDir)
-{
-    QDir dir(curDir);
-    QStringList fileList = dir.entryList(QDir::Files);
-    for (int i = 0; i < fileList.size(); i ++) {
-        if (! dir.remove(fileList[i])) {
-#ifdef Q_OS_WIN32
-            QProcess::execute(QString("attrib -R \"") + curDir + fileList[i] + "\"");
-#endif
-#ifdef Q_OS_LINUX
-            QProcess::execute(QString("chmod +w \"") + curDir + fileList[i] + "\"");
-#endif
-            dir.remove(fileList[i]);
-        }
-    }
-    QStringList dirList = dir.entryList(QDir::AllDirs | QDir::NoDotAndDotDot);
-    for (int i = 0; i < dirList.size(); i ++) {
-        clearPath(curDir + dirList[i] + QDir::separator());
-        dir.rmdir(dirList[i]);
-    }
-}
-
-void Contest::judge(Contestant *contestant)
-{
-    emit contestantJudgingStart(contestant->getContestantName());
-    QDir(QDir::current()).mkdir(Settings::temporaryPath());
-    for (int i = 0; i < taskList.size(); i ++) {
-        emit taskJudgingStarted(taskList[i]->getProblemTile());
-        
-        AssignmentThread *thread = new AssignmentThread();
-        connect(thread, SIGNAL(singleCaseFinished(int, int, int, int)),
-                this, SIGNAL(singleCaseFinished(int, int, int, int)));
-        connect(thread, SIGNAL(compileError(int, int)),
-                this, SIGNAL(compileError(int, int)));
-        connect(this, SIGNAL(stopJudgingSignal()),
-                thread, SLOT(stopJudgingSlot()));
-        thread->setSettings(settings);
-        thread->setTask(taskList[i]);
-        thread->setContestantName(contestant->getContestantName());
-        QEventLoop *eventLoop = new QEventLoop(this);
-        connect(thread, SIGNAL(finished()), eventLoop, SLOT(quit()));
-        thread->start();
-        eventLoop->exec();
-        delete eventLoop;
-        
-        if (stopJudging) {
-            delete thread;
-            clearPath(Settings::temporaryPath());
-            QDir().rmdir(Settings::temporaryPath());
-            return;
-        }
-        
-        contestant->setCompileState(i, thread->getCompileState());
-        contestant->setCompileMessage(i, thread->getCompileMessage());
-        contestant->setSourceFile(i, thread->getSourceFile());
-        contestant->setInputFiles(i, thread->getInputFiles());
-        contestant->setResult(i, thread->getResult());
-        contestant->setMessage(i, thread->getMessage());
-        contestant->setScore(i, thread->getScore());
-        contestant->setTimeUsed(i, thread->getTimeUsed());
-        contestant->setMemoryUsed(i, thread->getMemoryUsed());
-        QList< QPair<int, int> > needRejudge = thread->getNeedRejudge();
-        
-        delete thread;
-        clearPath(Settings::temporaryPath());
-        
-        if (needRejudge.size() > 0) {
-            AssignmentThread *thread = new AssignmentThread();
-            connect(thread, SIGNAL(singleCaseFinished(int, int, int, int)),
-                    this, SIGNAL(singleCaseFinished(int, int, int, int)));
-            connect(thread, SIGNAL(compileError(int, int)),
-                    this, SIGNAL(compileError(int, int)));
-            connect(this, SIGNAL(stopJudgingSignal()),
-                    thread, SLOT(stopJudgingSlot()));
-            thread->setCheckRejudgeMode(true);
-            thread->setNeedRejudge(needRejudge);
-            thread->setSettings(settings);
-            thread->setTask(taskList[i]);
-            thread->setContestantName(contestant->getContestantName());
-            QEventLoop *eventLoop = new QEventLoop(this);
-            connect(thread, SIGNAL(finished()), eventLoop, SLOT(quit()));
-            thread->start();
-            eventLoop->exec();
-            delete eventLoop;
-            
-            if (stopJudging) {
-                delete thread;
-                clearPath(Settings::temporaryPath());
-                QDir().rmdir(Settings::temporaryPath());
-                return;
-            }
-            
-            QList< QList<ResultState> > result = contestant->getResult(i);
-            QList<QStringList> message = contestant->getMessage(i);
-            QList< QList<int> > score = contestant->getSocre(i);
-            QList< QList<int> > timeUsed = contestant->getTimeUsed(i);
-            QList< QList<int> > memoryUsed = contestant->getMemoryUsed(i);
-            
-            for (int j = 0; j < needRejudge.size(); j ++) {
-                int a = needRejudge[j].first, b = needRejudge[j].second;
-                result[a][b] = thread->getResult()[a][b];
-                message[a][b] = thread->getMessage()[a][b];
-                score[a][b] = thread->getScore()[a][b];
-                timeUsed[a][b] = thread->getTimeUsed()[a][b];
-                memoryUsed[a][b] = thread->getMemoryUsed()[a][b];
-            }
-            
-            contestant->setResult(i, result);
-            contestant->setMessage(i, message);
-            contestant->setScore(i, score);
-            contestant->setTimeUsed(i, timeUsed);
-            contestant->setMemoryUsed(i, memoryUsed);
-            
-            delete thread;
-            clearPath(Settings::temporaryPath());
-        }
-        
-        contestant->setCheckJudged(i, true);
-        emit taskJudgingFinished();
-    }
-    contestant->setJudgingTime(QDateTime::currentDateTime());
-    QDir().rmdir(Settings::temporaryPath());
-    emit contestantJudgingFinished();
-}
-
-void Contest::judge(Contestant *contestant, int index)
-{
-    emit contestantJudgingStart(contestant->getContestantName());
-    QDir(QDir::current()).mkdir(Settings::temporaryPath());
-    
-    emit taskJudgingStarted(taskList[index]->getProblemTile());
-    
-    AssignmentThread *thread = new AssignmentThread();
-    connect(thread, SIGNAL(singleCaseFinished(int, int, int, int)),
-            this, SIGNAL(singleCaseFinished(int, int, int, int)));
-    connect(thread, SIGNAL(compileError(int, int)),
-            this, SIGNAL(compileError(int, int)));
-    connect(this, SIGNAL(stopJudgingSignal()),
-            thread, SLOT(stopJudgingSlot()));
-    thread->setSettings(settings);
-    thread->setTask(taskList[index]);
-    thread->setContestantName(contestant->getContestantName());
-    QEventLoop *eventLoop = new QEventLoop(this);
-    connect(thread, SIGNAL(finished()), eventLoop, SLOT(quit()));
-    thread->start();
-    eventLoop->exec();
-    delete eventLoop;
-    
-    if (stopJudging) {
-        delete thread;
-        clearPath(Settings::temporaryPath());
-        QDir().rmdir(Settings::temporaryPath());
-        return;
-    }
-    
-    contestant->setCompileState(index, thread->getCompileState());
-    contestant->setCompileMessage(index, thread->getCompileMessage());
-    contestant->setSourceFile(index, thread->getSourceFile());
-    contestant->setInputFiles(index, thread->getInputFiles());
-    contestant->setResult(index, thread->getResult());
-    contestant->setMessage(index, thread->getMessage());
-    contestant->setScore(index, thread->getScore());
-    contestant->setTimeUsed(index, thread->getTimeUsed());
-    contestant->setMemoryUsed(index, thread->getMemoryUsed());
-    QList< QPair<int, int> > needRejudge = thread->getNeedRejudge();
-    
-    delete thread;
-    clearPath(Settings::temporaryPath());
-    
-    if (needRejudge.size() > 0) {
-        AssignmentThread *thread = new AssignmentThread();
-        connect(thread, SIGNAL(singleCaseFinished(int, int, int, int)),
-                this, SIGNAL(singleCaseFinished(int, int, int, int)));
-        connect(thread, SIGNAL(compileError(int, int)),
-                this, SIGNAL(compileError(int, int)));
-        connect(this, SIGNAL(stopJudgingSignal()),
-                thread, SLOT(stopJudgingSlot()));
-        thread->setCheckRejudgeMode(true);
-        thread->setNeedRejudge(needRejudge);
-        thread->setSettings(settings);
-        thread->setTask(taskList[index]);
-        thread->setContestantName(contestant->getContestantName());
-        QEventLoop *eventLoop = new QEventLoop(this);
-        connect(thread, SIGNAL(finished()), eventLoop, SLOT(quit()));
-        thread->start();
-        eventLoop->exec();
-        delete eventLoop;
-        
-        if (stopJudging) {
-            delete thread;
-            clearPath(Settings::temporaryPath());
-            QDir().rmdir(Settings::temporaryPath());
-            return;
-        }
-        
-        QList< QList<ResultState> > result = contestant->getResult(index);
-        QList<QStringList> message = contestant->getMessage(index);
-        QList< QList<int> > score = contestant->getSocre(index);
-        QList< QList<int> > timeUsed = contestant->getTimeUsed(index);
-        QList< QList<int> > memoryUsed = contestant->getMemoryUsed(index);
-        
-        for (int i = 0; i < needRejudge.size(); i ++) {
-            int a = needRejudge[i].first, b = needRejudge[i].second;
-            result[a][b] = thread->getResult()[a][b];
-            message[a][b] = thread->getMessage()[a][b];
-            score[a][b] = thread->getScore()[a][b];
-            timeUsed[a][b] = thread->getTimeUsed()[a][b];
-            memoryUsed[a][b] = thread->getMemoryUsed()[a][b];
-        }
-        
-        contestant->setResult(index, result);
-        contestant->setMessage(index, message);
-        contestant->setScore(index, score);
-        contestant->setTimeUsed(index, timeUsed);
-        contestant->setMemoryUsed(index, memoryUsed);
-        
-        delete thread;
-        clearPath(Settings::temporaryPath());
-    }
-    
-    contestant->setCheckJudged(index, true);
-    emit taskJudgingFinished();
-    
-    contestant->setJudgingTime(QDateTime::currentDateTime());
-    QDir().rmdir(Settings::temporaryPath());
-    emit contestantJudgingFinished();
-}
-
-void Contest::judge(const QString &name)
-{
-    clearPath(Settings::temporaryPath());
-    stopJudging = false;
-    judge(contestantList.value(name));
-}
-
-void Contest::judge(const QString &name, int index)
-{
-    clearPath(Settings::temporaryPath());
-    stopJudging = false;
-    judge(contestantList.value(name), index);
-}
-
-void Contest::judgeAll()
-{
-    clearPath(Settings::temporaryPath());
-    stopJudging = false;
-    QList<Contestant*> contestants = contestantList.values();
-    for (int i = 0; i < contestants.size(); i ++) {
-        judge(contestants[i]);
-        if (stopJudging) break;
-    }
-}
-
-void Contest::stopJudgingSlot()
-{
-    stopJudging = true;
-    emit stopJudgingSignal();
-}
-
-void Contest::writeToStream(QDataStream &out)
-{
-    out << contestTitle;
-    out << taskList.size();
-    for (int i = 0; i < taskList.size(); i ++) {
-        taskList[i]->writeToStream(out);
-    }
-    out << contestantList.size();
-    QList<Contestant*> list = contestantList.values();
-    for (int i = 0; i < list.size(); i ++) {
-        list[i]->writeToStream(out);
-    }
-}
-
-void Contest::readFromStream(QDataStream &in)
-{
-    int count;
-    in >> contestTitle;
-    in >> count;
-    for (int i = 0; i < count; i ++) {
-        Task *newTask = new Task(this);
-        newTask->readFromStream(in);
-        newTask->refreshCompilerConfiguration(settings);
-        taskList.append(newTask);
-    }
-    in >> count;
-    for (int i = 0; i < count; i ++) {
-        Contestant *newContestant = new Contestant(this);
-        newContestant->readFromStream(in);
-        connect(this, SIGNAL(taskAddedForContestant()),
-                newContestant, SLOT(addTask()));
-        connect(this, SIGNAL(taskDeletedForContestant(int)),
-                newContestant, SLOT(deleteTask(int)));
-        contestantList.insert(newContestant->getContestantName(), newContestant);
-    }
-}
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include "contest.h"
+#include "task.h"
+#include "testcase.h"
+#include "settings.h"
+#include "compiler.h"
+#include "contestant.h"
+#include "judgingthread.h"
+#include "assignmentthread.h"
+#include "judgingcache.h"
+#include "workerpool.h"
+#include "judgingjournal.h"
+#include "contestantindex.h"
+#include "datacatalog.h"
+#include "datastager.h"
+#include "datagenerator.h"
+
+static void storeCase(ResultTable &table, AssignmentThread *thread, int testCaseIndex, int singleCaseIndex)
+{
+    int offset = table.getOffset(testCaseIndex, singleCaseIndex);
+    table.setInputFileAt(offset, thread->getInputFiles()[testCaseIndex][singleCaseIndex]);
+    table.setResultAt(offset, thread->getResult()[testCaseIndex][singleCaseIndex]);
+    table.setMessageAt(offset, thread->getMessage()[testCaseIndex][singleCaseIndex],
+                       thread->getMessageBlob()[testCaseIndex][singleCaseIndex]);
+    table.setScoreAt(offset, thread->getScore()[testCaseIndex][singleCaseIndex]);
+    table.setTimeUsedAt(offset, thread->getTimeUsed()[testCaseIndex][singleCaseIndex]);
+    table.setMemoryUsedAt(offset, thread->getMemoryUsed()[testCaseIndex][singleCaseIndex]);
+}
+
+Contest::Contest(QObject *parent) :
+    QObject(parent)
+{
+    judgingCache = new JudgingCache(this);
+    dataCatalog = new DataCatalog(this);
+    judgingCache->setHashSource(dataCatalog);
+    dataStager = new DataStager(this);
+    dataGenerator = new DataGenerator(this);
+    workerPool = new WorkerPool(this);
+    judgingJournal = new JudgingJournal(this);
+    contestantIndex = new ContestantIndex(this);
+    connect(contestantIndex, SIGNAL(indexChanged(QStringList, QStringList, QStringList)),
+            this, SLOT(contestantIndexChanged()));
+    connect(contestantIndex, SIGNAL(rescanFinished()),
+            this, SLOT(contestantIndexRescanned()));
+    settings = 0;
+    contestantRevision = 1;
+    rankListRevision = 0;
+    judging = false;
+    contestantIndexPending = false;
+    contestantPrunePending = false;
+    chunkFileGarbage = 0;
+    chunkFileIndexOffset = -1;
+    chunkFileLogLength = 0;
+}
+
+void Contest::setSettings(Settings *_settings)
+{
+    settings = _settings;
+}
+
+void Contest::setContestTitle(const QString &title)
+{
+    contestTitle = title;
+}
+
+const QString& Contest::getContestTitle() const
+{
+    return contestTitle;
+}
+
+Task* Contest::getTask(int index) const
+{
+    if (0 <= index && index < taskList.size()) {
+        return taskList[index];
+    } else {
+        return 0;
+    }
+}
+
+const QList<Task*>& Contest::getTaskList() const
+{
+    return taskList;
+}
+
+Contestant* Contest::getContestant(const QString &name) const
+{
+    if (contestantList.contains(name)) {
+        return contestantList.value(name);
+    } else {
+        return 0;
+    }
+}
+
+QList<Contestant*> Contest::getContestantList() const
+{
+    return contestantList.values();
+}
+
+JudgingJournal* Contest::getJudgingJournal() const
+{
+    return judgingJournal;
+}
+
+DataCatalog* Contest::getDataCatalog() const
+{
+    return dataCatalog;
+}
+
+QString Contest::getContestPath() const
+{
+    if (chunkFileName.isEmpty()) return QDir::currentPath();
+    return QFileInfo(chunkFileName).absolutePath();
+}
+
+void Contest::setTaskTieBreak(const QList<int> &taskList)
+{
+    rankList.setTaskTieBreak(taskList);
+    markContestantsChanged();
+}
+
+void Contest::markContestantsChanged()
+{
+    contestantRevision ++;
+    if (contestantRevision == 0) contestantRevision ++;
+}
+
+const RankList& Contest::getRankList() const
+{
+    RankList::TieBreak tieBreak = RankList::NoTieBreak;
+    if (settings && settings->getTieBreakByTime()) tieBreak = RankList::TotalTimeUsed;
+    if (rankList.getTieBreak() != tieBreak) {
+        rankList.setTieBreak(tieBreak);
+        rankListRevision = 0;
+    }
+    if (rankListRevision != contestantRevision) {
+        rankList.build(contestantList.values());
+        rankListRevision = contestantRevision;
+    }
+    return rankList;
+}
+
+int Contest::getTotalTimeLimit() const
+{
+    int total = 0;
+    for (int i = 0; i < taskList.size(); i ++) {
+        QList<TestCase*> testCaseList = taskList[i]->getTestCaseList();
+        for (int j = 0; j < testCaseList.size(); j ++) {
+            total += testCaseList[j]->getTimeLimit() * testCaseList[j]->getInputFiles().size();
+        }
+    }
+    return total;
+}
+
+void Contest::addTask(Task *task)
+{
+    task->setParent(this);
+    taskList.append(task);
+    connect(task, SIGNAL(problemTitleChanged(QString)),
+            this, SIGNAL(problemTitleChanged()));
+    emit taskAddedForContestant();
+    emit taskAddedForViewer();
+}
+
+void Contest::deleteTask(int index)
+{
+    if (0 <= index && index < taskList.size()) {
+        delete taskList[index];
+        taskList.removeAt(index);
+    }
+    emit taskDeletedForContestant(index);
+    emit taskDeletedForViewer(index);
+}
+
+void Contest::refreshContestantList()
+{
+    applyContestantNames(QDir(Settings::sourcePath()).entryList(QStringList(), QDir::Dirs | QDir::NoDotAndDotDot),
+                         true);
+}
+
+void Contest::watchContestants()
+{
+    contestantIndex->setSourcePath(Settings::sourcePath());
+}
+
+void Contest::rescanContestants()
+{
+    contestantIndex->rescan();
+}
+
+QByteArray Contest::getSourceFingerprint(const QString &name) const
+{
+    return contestantIndex->getFingerprint(name);
+}
+
+void Contest::contestantIndexChanged()
+{
+    updateContestants(false);
+}
+
+void Contest::contestantIndexRescanned()
+{
+    updateContestants(true);
+}
+
+void Contest::updateContestants(bool prune)
+{
+    if (judging) {
+        contestantIndexPending = true;
+        if (prune) contestantPrunePending = true;
+        return;
+    }
+    QStringList curNameList = contestantList.keys();
+    applyContestantNames(contestantIndex->getContestantNames(), prune);
+    if (contestantList.keys() != curNameList) {
+        emit contestantListChanged();
+    }
+}
+
+void Contest::applyContestantNames(const QStringList &nameList, bool prune)
+{
+    QSet<QString> nameSet = nameList.toSet();
+    QStringList curNameList = contestantList.keys();
+    bool sourceListed = ! nameList.isEmpty() && QDir(Settings::sourcePath()).exists();
+    if (prune && sourceListed) {
+        for (int i = 0; i < curNameList.size(); i ++) {
+            if (! nameSet.contains(curNameList[i])) {
+                delete contestantList[curNameList[i]];
+                contestantList.remove(curNameList[i]);
+                markContestantsChanged();
+            }
+        }
+    }
+    for (int i = 0; i < nameList.size(); i ++) {
+        if (! contestantList.contains(nameList[i])) {
+            Contestant *newContestant = new Contestant(this);
+            newContestant->setContestantName(nameList[i]);
+            for (int j = 0; j < taskList.size(); j ++) {
+                newContestant->addTask();
+            }
+            contestantList.insert(nameList[i], newContestant);
+            markContestantsChanged();
+            connect(this, SIGNAL(taskAddedForContestant()),
+                    newContestant, SLOT(addTask()));
+            connect(this, SIGNAL(taskDeletedForContestant(int)),
+                    newContestant, SLOT(deleteTask(int)));
+        }
+    }
+}
+
+void Contest::deleteContestant(const QString &name)
+{
+    if (! contestantList.contains(name)) return;
+    delete contestantList[name];
+    contestantList.remove(name);
+    markContestantsChanged();
+}
+
+void Contest::clearPath(const QString &curDir)
+{
+    QDir dir(curDir);
+    QStringList fileList = dir.entryList(QDir::Files);
+    for (int i = 0; i < fileList.size(); i ++) {
+        if (! dir.remove(fileList[i])) {
+#ifdef Q_OS_WIN32
+            QProcess::execute(QString("attrib -R \"") + curDir + fileList[i] + "\"");
+#endif
+#ifdef Q_OS_LINUX
+            QProcess::execute(QString("chmod +w \"") + curDir + fileList[i] + "\"");
+#endif
+            dir.remove(fileList[i]);
+        }
+    }
+    QStringList dirList = dir.entryList(QDir::AllDirs | QDir::NoDotAndDotDot);
+    for (int i = 0; i < dirList.size(); i ++) {
+        clearPath(curDir + dirList[i] + QDir::separator());
+        dir.rmdir(dirList[i]);
+    }
+}
+
+AssignmentThread* Contest::newAssignmentThread(Contestant *contestant, int index)
+{
+    AssignmentThread *thread = new AssignmentThread();
+    connect(thread, SIGNAL(singleCaseFinished(int, int, int, int)),
+            this, SIGNAL(singleCaseFinished(int, int, int, int)));
+    connect(thread, SIGNAL(compileError(int, int)),
+            this, SIGNAL(compileError(int, int)));
+    connect(this, SIGNAL(stopJudgingSignal()),
+            thread, SLOT(stopJudgingSlot()));
+    thread->setSettings(settings);
+    thread->setTask(taskList[index]);
+    thread->setContestantName(contestant->getContestantName());
+    thread->setJudgingCache(judgingCache);
+    thread->setDataStager(dataStager);
+    thread->setDataGenerator(dataGenerator);
+    thread->setJudgingJournal(judgingJournal, index);
+    if (workerPool->isRunning()) thread->setWorkerPool(workerPool);
+    return thread;
+}
+
+bool Contest::judgeTask(Contestant *contestant, int index)
+{
+    emit taskJudgingStarted(taskList[index]->getProblemTile());
+    stageTask(index);
+    
+    AssignmentThread *thread = newAssignmentThread(contestant, index);
+    thread->setFinishedCases(judgingJournal->getFinishedCases(contestant->getContestantName(), index));
+    QEventLoop *eventLoop = new QEventLoop(this);
+    connect(thread, SIGNAL(finished()), eventLoop, SLOT(quit()));
+    thread->start();
+    eventLoop->exec();
+    delete eventLoop;
+    
+    if (stopJudging) {
+        delete thread;
+        clearPath(Settings::temporaryPath());
+        QDir().rmdir(Settings::temporaryPath());
+        return false;
+    }
+    
+    contestant->setCompileState(index, thread->getCompileState());
+    contestant->setCompileMessage(index, thread->getCompileMessage(), thread->getCompileMessageBlob());
+    contestant->setSourceFile(index, thread->getSourceFile());
+    ResultTable table;
+    const QList< QList<ResultState> > &result = thread->getResult();
+    QList<int> sizes;
+    for (int i = 0; i < result.size(); i ++) {
+        sizes.append(result[i].size());
+    }
+    table.reshape(sizes);
+    for (int i = 0; i < result.size(); i ++) {
+        for (int j = 0; j < result[i].size(); j ++) {
+            storeCase(table, thread, i, j);
+        }
+    }
+    contestant->setResultTable(index, table);
+    QList< QPair<int, int> > needRejudge = thread->getNeedRejudge();
+    
+    delete thread;
+    clearPath(Settings::temporaryPath());
+    
+    if (needRejudge.size() > 0) {
+        AssignmentThread *thread = newAssignmentThread(contestant, index);
+        thread->setCheckRejudgeMode(true);
+        thread->setNeedRejudge(needRejudge);
+        QEventLoop *eventLoop = new QEventLoop(this);
+        connect(thread, SIGNAL(finished()), eventLoop, SLOT(quit()));
+        thread->start();
+        eventLoop->exec();
+        delete eventLoop;
+        
+        if (stopJudging) {
+            delete thread;
+            clearPath(Settings::temporaryPath());
+            QDir().rmdir(Settings::temporaryPath());
+            return false;
+        }
+        
+        ResultTable table = contestant->getResultTable(index);
+        for (int i = 0; i < needRejudge.size(); i ++) {
+            storeCase(table, thread, needRejudge[i].first, needRejudge[i].second);
+        }
+        contestant->setResultTable(index, table);
+        
+        delete thread;
+        clearPath(Settings::temporaryPath());
+    }
+    
+    contestant->setCheckJudged(index, true);
+    judgingJournal->taskFinished(contestant, index, taskList[index]->getProblemTile());
+    emit taskJudgingFinished();
+    return true;
+}
+
+void Contest::judge(Contestant *contestant)
+{
+    emit contestantJudgingStart(contestant->getContestantName());
+    QDir(QDir::current()).mkdir(Settings::temporaryPath());
+    for (int i = 0; i < taskList.size(); i ++) {
+        if (judgingJournal->isTaskFinished(contestant->getContestantName(), i)) continue;
+        if (! judgeTask(contestant, i)) return;
+    }
+    contestant->setJudgingTime(QDateTime::currentDateTime());
+    judgingJournal->contestantFinished(contestant);
+    QDir().rmdir(Settings::temporaryPath());
+    emit contestantJudgingFinished();
+}
+
+void Contest::judge(Contestant *contestant, int index)
+{
+    emit contestantJudgingStart(contestant->getContestantName());
+    QDir(QDir::current()).mkdir(Settings::temporaryPath());
+    if (! judgingJournal->isTaskFinished(contestant->getContestantName(), index)) {
+        if (! judgeTask(contestant, index)) return;
+    }
+    contestant->setJudgingTime(QDateTime::currentDateTime());
+    judgingJournal->contestantFinished(contestant);
+    QDir().rmdir(Settings::temporaryPath());
+    emit contestantJudgingFinished();
+}
+
+void Contest::judge(const QString &name)
+{
+    judge(QStringList(name));
+}
+
+void Contest::judge(const QString &name, int index)
+{
+    if (! contestantList.contains(name)) return;
+    clearPath(Settings::temporaryPath());
+    stopJudging = false;
+    judging = true;
+    prepareWorkerPool();
+    refreshDataCatalog();
+    prepareDataStager();
+    judgingJournal->runStarted(QStringList(name), index);
+    judge(contestantList.value(name), index);
+    if (! stopJudging) judgingJournal->runFinished();
+    judgingFinished();
+}
+
+void Contest::judge(const QStringList &nameList)
+{
+    clearPath(Settings::temporaryPath());
+    stopJudging = false;
+    judging = true;
+    prepareWorkerPool();
+    refreshDataCatalog();
+    prepareDataStager();
+    judgingJournal->runStarted(nameList, -1);
+    for (int i = 0; i < nameList.size(); i ++) {
+        Contestant *contestant = contestantList.value(nameList[i]);
+        if (contestant) judge(contestant);
+        if (stopJudging) break;
+    }
+    if (! stopJudging) judgingJournal->runFinished();
+    judgingFinished();
+}
+
+void Contest::judgeAll()
+{
+    judge(QStringList(contestantList.keys()));
+}
+
+void Contest::resumeJudging()
+{
+    if (! judgingJournal->hasUnfinishedRun()) return;
+    clearPath(Settings::temporaryPath());
+    stopJudging = false;
+    judging = true;
+    prepareWorkerPool();
+    refreshDataCatalog();
+    prepareDataStager();
+    QStringList nameList = judgingJournal->getRunContestants();
+    int index = judgingJournal->getRunTaskIndex();
+    for (int i = 0; i < nameList.size(); i ++) {
+        Contestant *contestant = contestantList.value(nameList[i]);
+        if (! contestant) continue;
+        if (index == -1) {
+            judge(contestant);
+        } else if (index < taskList.size()) {
+            judge(contestant, index);
+        }
+        if (stopJudging) break;
+    }
+    if (! stopJudging) judgingJournal->runFinished();
+    judgingFinished();
+}
+
+void Contest::judgingFinished()
+{
+    judging = false;
+    dataStager->clear();
+    dataGenerator->clear();
+    if (contestantIndexPending) {
+        bool prune = contestantPrunePending;
+        contestantIndexPending = false;
+        contestantPrunePending = false;
+        updateContestants(prune);
+    }
+}
+
+void Contest::prepareWorkerPool()
+{
+    int number = settings->getNumberOfWorkerProcesses();
+    if (number <= 0) {
+        workerPool->stop();
+        return;
+    }
+    if (workerPool->isRunning() && workerPool->getNumberOfWorkers() == number) return;
+    workerPool->start(number);
+}
+
+void Contest::prepareDataStager()
+{
+    dataStager->setMemoryLimit(qint64(settings->getStagingMemoryLimit()) * 1024 * 1024);
+}
+
+void Contest::stageTask(int index)
+{
+    dataStager->stageFiles(getDataFiles(index), true);
+    if (taskList.size() > 1) {
+        dataStager->stageFiles(getDataFiles((index + 1) % taskList.size()), false);
+    }
+}
+
+void Contest::stopJudgingSlot()
+{
+    stopJudging = true;
+    emit stopJudgingSignal();
+}
+
+void Contest::dataFilesChanged(const QStringList &fileNames)
+{
+    judgingCache->invalidateFiles(fileNames);
+    dataCatalog->refresh(fileNames);
+}
+
+void Contest::refreshDataCatalog()
+{
+    QStringList fileNames;
+    for (int i = 0; i < taskList.size(); i ++) {
+        fileNames += getDataFiles(i);
+    }
+    dataCatalog->setTrackedFiles(fileNames);
+}
+
+QStringList Contest::getDataFiles(int index) const
+{
+    QStringList fileNames;
+    QList<TestCase*> testCaseList = taskList[index]->getTestCaseList();
+    for (int i = 0; i < testCaseList.size(); i ++) {
+        const QStringList &inputFiles = testCaseList[i]->getInputFiles();
+        const QStringList &outputFiles = testCaseList[i]->getOutputFiles();
+        for (int j = 0; j < inputFiles.size(); j ++) {
+            fileNames.append(Settings::dataPath() + inputFiles[j]);
+        }
+        for (int j = 0; j < outputFiles.size(); j ++) {
+            fileNames.append(Settings::dataPath() + outputFiles[j]);
+        }
+    }
+    if (taskList[index]->getComparisonMode() == Task::SpecialJudgeMode) {
+        fileNames.append(Settings::dataPath() + taskList[index]->getSpecialJudge());
+    }
+    return fileNames;
+}
+
+void Contest::writeToStream(QDataStream &out)
+{
+    out << contestTitle;
+    out << taskList.size();
+    for (int i = 0; i < taskList.size(); i ++) {
+        taskList[i]->writeToStream(out);
+    }
+    out << contestantList.size();
+    QList<Contestant*> list = contestantList.values();
+    for (int i = 0; i < list.size(); i ++) {
+        list[i]->writeToStream(out);
+    }
+}
+
+void Contest::readFromStream(QDataStream &in)
+{
+    int count;
+    in >> contestTitle;
+    in >> count;
+    for (int i = 0; i < count; i ++) {
+        Task *newTask = new Task(this);
+        newTask->readFromStream(in);
+        newTask->refreshCompilerConfiguration(settings);
+        taskList.append(newTask);
+    }
+    in >> count;
+    for (int i = 0; i < count; i ++) {
+        Contestant *newContestant = new Contestant(this);
+        newContestant->readFromStream(in);
+        connect(this, SIGNAL(taskAddedForContestant()),
+                newContestant, SLOT(addTask()));
+        connect(this, SIGNAL(taskDeletedForContestant(int)),
+                newContestant, SLOT(deleteTask(int)));
+        contestantList.insert(newContestant->getContestantName(), newContestant);
+    }
+    markContestantsChanged();
+}
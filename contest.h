@@ -1,82 +1,140 @@
-/***************************************************************************
-    This file is part of Project Lemon
-    Copyright (C) 2011 Zhipeng Jia
-
-    This program is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    This program is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with this program.  If not, see <http://www.gnu.org/licenses/>.
-***************************************************************************/
-
-#ifndef CONTEST_H
-#define CONTEST_H
-
-#include <QtCore>
-#include <QObject>
-#include "globaltype.h"
-#define MagicNumber 0x20111127
-
-class Task;
-class Settings;
-class Contestant;
-
-class Contest : public QObject
-{
-    Q_OBJECT
-public:
-    explicit Contest(QObject *parent = 0);
-    void setSettings(Settings*);
-    void setContestTitle(const QString&);
-    const QString& getContestTitle() const;
-    Task* getTask(int) const;
-    const QList<Task*>& getTaskList() const;
-    Contestant* getContestant(const QString&) const;
-    QList<Contestant*> getContestantList() const;
-    int getTotalTimeLimit() const;
-    void addTask(Task*);
-    void deleteTask(int);
-    void refreshContestantList();
-    void deleteContestant(const QString&);
-    void writeToStream(QDataStream&);
-    void readFromStream(QDataStream&);
-
-private:
-    QString contestTitle;
-    Settings *settings;
-    QList<Task*> taskList;
-    QMap<QString, Contestant*> contestantList;
-    bool stopJudging;
-    void judge(Contestant*);
-    void judge(Contestant*, int);
-    void clearPath(const QString&);
-
-public slots:
-    void judge(const QString&);
-    void judge(const QString&, int);
-    void judgeAll();
-    void stopJudgingSlot();
-
-signals:
-    void taskAddedForContestant();
-    void taskDeletedForContestant(int);
-    void taskAddedForViewer();
-    void taskDeletedForViewer(int);
-    void problemTitleChanged();
-    void singleCaseFinished(int, int, int, int);
-    void taskJudgingStarted(QString);
-    void taskJudgingFinished();
-    void contestantJudgingStart(QString);
-    void contestantJudgingFinished();
-    void compileError(int, int);
-    void stopJudgingSignal();
-};
-
-#endif // CONTEST_H
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#ifndef CONTEST_H
+#define CONTEST_H
+
+#include <QtCore>
+#include <QObject>
+#include "globaltype.h"
+#include "contestfile.h"
+#include "ranklist.h"
+#define MagicNumber 0x20111127
+
+class Task;
+class Settings;
+class Contestant;
+class JudgingCache;
+class DataCatalog;
+class DataStager;
+class DataGenerator;
+class WorkerPool;
+class JudgingJournal;
+class AssignmentThread;
+class ContestantIndex;
+
+class Contest : public QObject
+{
+    Q_OBJECT
+    friend class ContestFile;
+public:
+    explicit Contest(QObject *parent = 0);
+    void setSettings(Settings*);
+    void setTaskTieBreak(const QList<int>&);
+    void markContestantsChanged();
+    void setContestTitle(const QString&);
+    const QString& getContestTitle() const;
+    Task* getTask(int) const;
+    const QList<Task*>& getTaskList() const;
+    Contestant* getContestant(const QString&) const;
+    QList<Contestant*> getContestantList() const;
+    JudgingJournal* getJudgingJournal() const;
+    DataCatalog* getDataCatalog() const;
+    const RankList& getRankList() const;
+    QString getContestPath() const;
+    int getTotalTimeLimit() const;
+    void addTask(Task*);
+    void deleteTask(int);
+    void refreshContestantList();
+    void watchContestants();
+    void rescanContestants();
+    void refreshDataCatalog();
+    QByteArray getSourceFingerprint(const QString&) const;
+    void deleteContestant(const QString&);
+    void writeToStream(QDataStream&);
+    void readFromStream(QDataStream&);
+
+private:
+    QString contestTitle;
+    Settings *settings;
+    QList<Task*> taskList;
+    QMap<QString, Contestant*> contestantList;
+    mutable RankList rankList;
+    quint32 contestantRevision;
+    mutable quint32 rankListRevision;
+    JudgingCache *judgingCache;
+    DataCatalog *dataCatalog;
+    DataStager *dataStager;
+    DataGenerator *dataGenerator;
+    WorkerPool *workerPool;
+    JudgingJournal *judgingJournal;
+    ContestantIndex *contestantIndex;
+    QString chunkFileName;
+    qint64 chunkFileGarbage;
+    qint64 chunkFileIndexOffset;
+    int chunkFileLogLength;
+    QMap<QString, FileChunk> contestantChunks;
+    QList<FileChunk> taskChunks;
+    QList<QByteArray> taskChunkHashes;
+    bool stopJudging;
+    bool judging;
+    bool contestantIndexPending;
+    bool contestantPrunePending;
+    AssignmentThread* newAssignmentThread(Contestant*, int);
+    bool judgeTask(Contestant*, int);
+    void judge(Contestant*);
+    void judge(Contestant*, int);
+    void clearPath(const QString&);
+    void prepareWorkerPool();
+    void prepareDataStager();
+    void stageTask(int);
+    QStringList getDataFiles(int) const;
+    void applyContestantNames(const QStringList&, bool);
+    void updateContestants(bool);
+    void judgingFinished();
+
+public slots:
+    void judge(const QString&);
+    void judge(const QString&, int);
+    void judge(const QStringList&);
+    void judgeAll();
+    void resumeJudging();
+    void stopJudgingSlot();
+    void dataFilesChanged(const QStringList&);
+
+private slots:
+    void contestantIndexChanged();
+    void contestantIndexRescanned();
+
+signals:
+    void contestantListChanged();
+    void taskAddedForContestant();
+    void taskDeletedForContestant(int);
+    void taskAddedForViewer();
+    void taskDeletedForViewer(int);
+    void problemTitleChanged();
+    void singleCaseFinished(int, int, int, int);
+    void taskJudgingStarted(QString);
+    void taskJudgingFinished();
+    void contestantJudgingStart(QString);
+    void contestantJudgingFinished();
+    void compileError(int, int);
+    void stopJudgingSignal();
+};
+
+#endif // CONTEST_H
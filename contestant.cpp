@@ -1,280 +1,476 @@
-/***************************************************************************
-    This file is part of Project Lemon
-    Copyright (C) 2011 Zhipeng Jia
-
-    This program is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    This program is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with this program.  If not, see <http://www.gnu.org/licenses/>.
-***************************************************************************/
-
-#include "contestant.h"
-#include "contest.h"
-
-Contestant::Contestant(QObject *parent) :
-    QObject(parent)
-{
-}
-
-const QString& Contestant::getContestantName() const
-{
-    return contestantName;
-}
-
-bool Contestant::getCheckJudged(int index) const
-{
-    return checkJudged[index];
-}
-
-CompileState Contestant::getCompileState(int index) const
-{
-    return compileState[index];
-}
-
-const QString& Contestant::getSourceFile(int index) const
-{
-    return sourceFile[index];
-}
-
-const QString& Contestant::getCompileMessage(int index) const
-{
-    return compileMesaage[index];
-}
-
-const QList<QStringList>& Contestant::getInputFiles(int index) const
-{
-    return inputFiles[index];
-}
-
-const QList< QList<ResultState> >& Contestant::getResult(int index) const
-{
-    return result[index];
-}
-
-const QList<QStringList>& Contestant::getMessage(int index) const
-{
-    return message[index];
-}
-
-const QList< QList<int> >& Contestant::getSocre(int index) const
-{
-    return score[index];
-}
-
-const QList< QList<int> >& Contestant::getTimeUsed(int index) const
-{
-    return timeUsed[index];
-}
-
-const QList< QList<int> >& Contestant::getMemoryUsed(int index) const
-{
-    return memoryUsed[index];
-}
-
-QDateTime Contestant::getJudingTime() const
-{
-    return judgingTime;
-}
-
-void Contestant::setContestantName(const QString &name)
-{
-    contestantName = name;
-}
-
-void Contestant::setCheckJudged(int index, bool check)
-{
-    checkJudged[index] = check;
-}
-
-void Contestant::setCompileState(int index, CompileState state)
-{
-    compileState[index] = state;
-}
-
-void Contestant::setSourceFile(int index, const QString &fileName)
-{
-    sourceFile[index] = fileName;
-}
-
-void Contestant::setCompileMessage(int index, const QString &text)
-{
-    compileMesaage[index] = text;
-}
-
-void Contestant::setInputFiles(int index, const QList<QStringList> &files)
-{
-    inputFiles[index] = files;
-}
-
-void Contestant::setResult(int index, const QList< QList<ResultState> > &_result)
-{
-    result[index] = _result;
-}
-
-void Contestant::setMessage(int index, const QList<QStringList>&_message)
-{
-    message[index] = _message;
-}
-
-void Contestant::setScore(int index, const QList< QList<int> > &_score)
-{
-    score[index] = _score;
-}
-
-void Contestant::setTimeUsed(int index, const QList< QList<int> > &_timeUsed)
-{
-    timeUsed[index] = _timeUsed;
-}
-
-void Contestant::setMemoryUsed(int index, const QList< QList<int> > &_memoryUsed)
-{
-    memoryUsed[index] = _memoryUsed;
-}
-
-void Contestant::setJudgingTime(QDateTime time)
-{
-    judgingTime = time;
-}
-
-void Contestant::addTask()
-{
-    checkJudged.append(false);
-    compileState.append(NoValidSourceFile);
-    sourceFile.append("");
-    compileMesaage.append("");
-    inputFiles.append(QList<QStringList>());
-    result.append(QList< QList<ResultState> >());
-    message.append(QList<QStringList>());
-    score.append(QList< QList<int> >());
-    timeUsed.append(QList< QList<int> >());
-    memoryUsed.append(QList< QList<int> >());
-}
-
-void Contestant::deleteTask(int index)
-{
-    checkJudged.removeAt(index);
-    compileState.removeAt(index);
-    sourceFile.removeAt(index);
-    compileMesaage.removeAt(index);
-    inputFiles.removeAt(index);
-    result.removeAt(index);
-    message.removeAt(index);
-    score.removeAt(index);
-    timeUsed.removeAt(index);
-    memoryUsed.removeAt(index);
-}
-
-int Contestant::getTaskScore(int index) const
-{
-    if (0 > index || index >= checkJudged.size()) return -1;
-    if (! checkJudged[index]) return -1;
-    int total = 0;
-    for (int i = 0; i < score[index].size(); i ++) {
-        int minv = 1000000000;
-        for (int j = 0; j < score[index][i].size(); j ++) {
-            if (score[index][i][j] < minv) minv = score[index][i][j];
-        }
-        if (minv == 1000000000) minv = 0;
-        total += minv;
-    }
-    return total;
-}
-
-int Contestant::getTotalScore() const
-{
-    if (checkJudged.size() == 0) return -1;
-    for (int i = 0; i < checkJudged.size(); i ++) {
-        if (! checkJudged[i]) return -1;
-    }
-    int total = 0;
-    for (int i = 0; i < score.size(); i ++) {
-        total += getTaskScore(i);
-    }
-    return total;
-}
-
-int Contestant::getTotalUsedTime() const
-{
-    if (checkJudged.size() == 0) return -1;
-    for (int i = 0; i < checkJudged.size(); i ++) {
-        if (! checkJudged[i]) return -1;
-    }
-    int total = 0;
-    for (int i = 0; i < timeUsed.size(); i ++) {
-        for (int j = 0; j < timeUsed[i].size(); j ++) {
-            for (int k = 0; k < timeUsed[i][j].size(); k ++) {
-                if (timeUsed[i][j][k] >= 0) total += timeUsed[i][j][k];
-            }
-        }
-    }
-    return total;
-}
-
-void Contestant::writeToStream(QDataStream &out)
-{
-    out << contestantName;
-    out << checkJudged;
-    out << sourceFile;
-    out << compileMesaage;
-    out << inputFiles;
-    out << message;
-    out << score;
-    out << timeUsed;
-    out << memoryUsed;
-    out << judgingTime;
-    out << compileState.size();
-    for (int i = 0; i < compileState.size(); i ++) {
-        out << int(compileState[i]);
-    }
-    out << result.size();
-    for (int i = 0; i < result.size(); i ++) {
-        out << result[i].size();
-        for (int j = 0; j < result[i].size(); j ++) {
-            out << result[i][j].size();
-            for (int k = 0; k < result[i][j].size(); k ++) {
-                out << int(result[i][j][k]);
-            }
-        }
-    }
-}
-
-void Contestant::readFromStream(QDataStream &in)
-{
-    in >> contestantName;
-    in >> checkJudged;
-    in >> sourceFile;
-    in >> compileMesaage;
-    in >> inputFiles;
-    in >> message;
-    in >> score;
-    in >> timeUsed;
-    in >> memoryUsed;
-    in >> judgingTime;
-    int count, _count, __count, tmp;
-    in >> count;
-    for (int i = 0; i < count; i ++) {
-        in >> tmp;
-        compileState.append(CompileState(tmp));
-    }
-    in >> count;
-    for (int i = 0; i < count; i ++) {
-        result.append(QList< QList<ResultState> >());
-        in >> _count;
-        for (int j = 0; j < _count; j ++) {
-            result[i].append(QList<ResultState>());
-            in >> __count;
-            for (int k = 0; k < __count; k ++) {
-                in >> tmp;
-                result[i][j].append(ResultState(tmp));
-            }
-        }
-    }
-}
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include "contestant.h"
+#include "contest.h"
+#include "messagepool.h"
+
+Contestant::Contestant(QObject *parent) :
+    QObject(parent)
+{
+    loaded = true;
+    loadFailed = false;
+    dirty = true;
+    revision = 0;
+    summaryTotalUsedTime = -1;
+    aggregatesValid = false;
+}
+
+const QString& Contestant::getContestantName() const
+{
+    return contestantName;
+}
+
+bool Contestant::getCheckJudged(int index) const
+{
+    return checkJudged[index];
+}
+
+CompileState Contestant::getCompileState(int index) const
+{
+    ensureLoaded();
+    return compileState[index];
+}
+
+const QString& Contestant::getSourceFile(int index) const
+{
+    ensureLoaded();
+    return sourceFile[index];
+}
+
+const QString& Contestant::getCompileMessage(int index) const
+{
+    ensureLoaded();
+    return compileMesaage[index];
+}
+
+QByteArray Contestant::getCompileMessageBlob(int index) const
+{
+    ensureLoaded();
+    return compileMessageBlob.value(index);
+}
+
+const ResultTable& Contestant::getResultTable(int index) const
+{
+    ensureLoaded();
+    return resultTable[index];
+}
+
+QDateTime Contestant::getJudingTime() const
+{
+    return judgingTime;
+}
+
+void Contestant::setContestantName(const QString &name)
+{
+    markDirty();
+    contestantName = name;
+}
+
+void Contestant::setCheckJudged(int index, bool check)
+{
+    markDirty();
+    checkJudged[index] = check;
+}
+
+void Contestant::setCompileState(int index, CompileState state)
+{
+    markDirty();
+    compileState[index] = state;
+}
+
+void Contestant::setSourceFile(int index, const QString &fileName)
+{
+    markDirty();
+    sourceFile[index] = fileName;
+}
+
+void Contestant::setCompileMessage(int index, const QString &text, const QByteArray &blob)
+{
+    markDirty();
+    compileMesaage[index] = MessagePool::intern(text);
+    while (compileMessageBlob.size() <= index) compileMessageBlob.append(QByteArray());
+    compileMessageBlob[index] = blob;
+}
+
+void Contestant::setResultTable(int index, const ResultTable &table)
+{
+    markDirty();
+    resultTable[index] = table;
+}
+
+void Contestant::setJudgingTime(QDateTime time)
+{
+    markDirty();
+    judgingTime = time;
+}
+
+void Contestant::addTask()
+{
+    markDirty();
+    checkJudged.append(false);
+    compileState.append(NoValidSourceFile);
+    sourceFile.append("");
+    compileMesaage.append("");
+    while (compileMessageBlob.size() < compileMesaage.size()) compileMessageBlob.append(QByteArray());
+    resultTable.append(ResultTable());
+}
+
+void Contestant::deleteTask(int index)
+{
+    markDirty();
+    checkJudged.removeAt(index);
+    compileState.removeAt(index);
+    sourceFile.removeAt(index);
+    compileMesaage.removeAt(index);
+    if (index < compileMessageBlob.size()) compileMessageBlob.removeAt(index);
+    resultTable.removeAt(index);
+}
+
+int Contestant::getTaskScore(int index) const
+{
+    if (0 > index || index >= checkJudged.size()) return -1;
+    if (! checkJudged[index]) return -1;
+    if (! loaded) return summaryTaskScore.value(index, -1);
+    return resultTable[index].getTotalScore();
+}
+
+int Contestant::getTotalScore() const
+{
+    if (! aggregatesValid) updateAggregates();
+    return totalScore;
+}
+
+int Contestant::getTotalUsedTime() const
+{
+    if (! aggregatesValid) updateAggregates();
+    return totalUsedTime;
+}
+
+void Contestant::updateAggregates() const
+{
+    aggregatesValid = true;
+    totalScore = totalUsedTime = -1;
+    if (checkJudged.size() == 0) return;
+    for (int i = 0; i < checkJudged.size(); i ++) {
+        if (! checkJudged[i]) return;
+    }
+    
+    totalScore = 0;
+    for (int i = 0; i < checkJudged.size(); i ++) {
+        totalScore += getTaskScore(i);
+    }
+    if (! loaded) {
+        totalUsedTime = summaryTotalUsedTime;
+        return;
+    }
+    totalUsedTime = 0;
+    for (int i = 0; i < resultTable.size(); i ++) {
+        totalUsedTime += resultTable[i].getTotalTimeUsed();
+    }
+}
+
+bool Contestant::isLoaded() const
+{
+    return loaded;
+}
+
+bool Contestant::hasLoadError() const
+{
+    return loadFailed;
+}
+
+bool Contestant::isDirty() const
+{
+    return dirty;
+}
+
+const QString& Contestant::getChunkFile() const
+{
+    return chunkFile;
+}
+
+const FileChunk& Contestant::getChunk() const
+{
+    return chunk;
+}
+
+void Contestant::setChunk(const QString &fileName, const FileChunk &_chunk)
+{
+    chunkFile = fileName;
+    chunk = _chunk;
+    dirty = false;
+    loadFailed = false;
+}
+
+quint32 Contestant::getRevision() const
+{
+    return revision;
+}
+
+void Contestant::copyFrom(Contestant *other)
+{
+    other->ensureLoaded();
+    contestantName = other->contestantName;
+    checkJudged = other->checkJudged;
+    compileState = other->compileState;
+    sourceFile = other->sourceFile;
+    compileMesaage = other->compileMesaage;
+    compileMessageBlob = other->compileMessageBlob;
+    resultTable = other->resultTable;
+    judgingTime = other->judgingTime;
+    loaded = true;
+    loadFailed = false;
+    dirty = true;
+    aggregatesValid = false;
+}
+
+void Contestant::ensureLoaded() const
+{
+    if (loaded || loadFailed) return;
+    
+    Contestant *self = const_cast<Contestant*>(this);
+    QByteArray data;
+    if (ContestFile::readChunk(chunkFile, chunk, data)) {
+        loaded = true;
+        QDataStream in(data);
+        quint32 checkNumber;
+        in >> checkNumber;
+        if (checkNumber == quint32(ContestantBlobMagicNumber)) {
+            self->readCompactFromStream(in, true);
+        } else if (checkNumber == quint32(ContestantMagicNumber)) {
+            self->readCompactFromStream(in, false);
+        } else {
+            QDataStream _in(data);
+            self->compileState.clear();
+            self->readFromStream(_in);
+        }
+    } else {
+        // The stored chunk stays untouched: fill in placeholders for the
+        // getters but keep the contestant unloaded and clean, so the summary
+        // is still used for scores and the next save reuses the old chunk.
+        loadFailed = true;
+        self->compileState.clear();
+        self->sourceFile.clear();
+        self->compileMesaage.clear();
+        self->compileMessageBlob.clear();
+        self->resultTable.clear();
+        for (int i = 0; i < checkJudged.size(); i ++) {
+            self->compileState.append(NoValidSourceFile);
+            self->sourceFile.append("");
+            self->compileMesaage.append("");
+            self->resultTable.append(ResultTable());
+        }
+    }
+}
+
+void Contestant::unload()
+{
+    if (! loaded || dirty || chunkFile.isEmpty()) return;
+    QList<int> taskScore;
+    for (int i = 0; i < checkJudged.size(); i ++) {
+        taskScore.append(getTaskScore(i));
+    }
+    summaryTotalUsedTime = getTotalUsedTime();
+    summaryTaskScore = taskScore;
+    compileState.clear();
+    sourceFile.clear();
+    compileMesaage.clear();
+    compileMessageBlob.clear();
+    resultTable.clear();
+    loaded = false;
+    aggregatesValid = false;
+}
+
+void Contestant::markDirty()
+{
+    ensureLoaded();
+    if (loadFailed && ! loaded) {
+        // An explicit change replaces the unreadable results; the tasks
+        // whose results were lost have to be judged again.
+        loaded = true;
+        for (int i = 0; i < checkJudged.size(); i ++) {
+            checkJudged[i] = false;
+        }
+    }
+    dirty = true;
+    revision ++;
+    aggregatesValid = false;
+    Contest *contest = qobject_cast<Contest*>(parent());
+    if (contest) contest->markContestantsChanged();
+}
+
+void Contestant::writeToStream(QDataStream &out)
+{
+    ensureLoaded();
+    QList< QList<QStringList> > inputFiles, message;
+    QList< QList< QList<int> > > score, timeUsed, memoryUsed;
+    for (int i = 0; i < resultTable.size(); i ++) {
+        inputFiles.append(resultTable[i].getInputFiles());
+        message.append(resultTable[i].getMessage());
+        score.append(resultTable[i].getScore());
+        timeUsed.append(resultTable[i].getTimeUsed());
+        memoryUsed.append(resultTable[i].getMemoryUsed());
+    }
+    out << contestantName;
+    out << checkJudged;
+    out << sourceFile;
+    out << compileMesaage;
+    out << inputFiles;
+    out << message;
+    out << score;
+    out << timeUsed;
+    out << memoryUsed;
+    out << judgingTime;
+    out << compileState.size();
+    for (int i = 0; i < compileState.size(); i ++) {
+        out << int(compileState[i]);
+    }
+    out << resultTable.size();
+    for (int i = 0; i < resultTable.size(); i ++) {
+        QList< QList<ResultState> > result = resultTable[i].getResult();
+        out << result.size();
+        for (int j = 0; j < result.size(); j ++) {
+            out << result[j].size();
+            for (int k = 0; k < result[j].size(); k ++) {
+                out << int(result[j][k]);
+            }
+        }
+    }
+}
+
+void Contestant::readFromStream(QDataStream &in)
+{
+    QList< QList<QStringList> > inputFiles, message;
+    QList< QList< QList<int> > > score, timeUsed, memoryUsed;
+    QList< QList< QList<ResultState> > > result;
+    in >> contestantName;
+    in >> checkJudged;
+    in >> sourceFile;
+    in >> compileMesaage;
+    in >> inputFiles;
+    in >> message;
+    in >> score;
+    in >> timeUsed;
+    in >> memoryUsed;
+    in >> judgingTime;
+    int count, _count, __count, tmp;
+    in >> count;
+    for (int i = 0; i < count; i ++) {
+        in >> tmp;
+        compileState.append(CompileState(tmp));
+    }
+    in >> count;
+    for (int i = 0; i < count; i ++) {
+        result.append(QList< QList<ResultState> >());
+        in >> _count;
+        for (int j = 0; j < _count; j ++) {
+            result[i].append(QList<ResultState>());
+            in >> __count;
+            for (int k = 0; k < __count; k ++) {
+                in >> tmp;
+                result[i][j].append(ResultState(tmp));
+            }
+        }
+    }
+    
+    resultTable.clear();
+    for (int i = 0; i < checkJudged.size(); i ++) {
+        ResultTable table;
+        table.setInputFiles(inputFiles.value(i));
+        table.setResult(result.value(i));
+        table.setMessage(message.value(i));
+        table.setScore(score.value(i));
+        table.setTimeUsed(timeUsed.value(i));
+        table.setMemoryUsed(memoryUsed.value(i));
+        resultTable.append(table);
+    }
+    compileMessageBlob.clear();
+    aggregatesValid = false;
+}
+
+void Contestant::writeCompactToStream(QDataStream &out)
+{
+    ensureLoaded();
+    out << quint32(ContestantBlobMagicNumber);
+    out << contestantName;
+    out << checkJudged;
+    out << sourceFile;
+    out << compileMesaage;
+    out << compileMessageBlob;
+    out << judgingTime;
+    out << compileState.size();
+    for (int i = 0; i < compileState.size(); i ++) {
+        out << int(compileState[i]);
+    }
+    out << resultTable.size();
+    for (int i = 0; i < resultTable.size(); i ++) {
+        resultTable[i].writeToStream(out);
+    }
+}
+
+void Contestant::readCompactFromStream(QDataStream &in, bool hasBlobs)
+{
+    in >> contestantName;
+    in >> checkJudged;
+    in >> sourceFile;
+    in >> compileMesaage;
+    compileMessageBlob.clear();
+    if (hasBlobs) in >> compileMessageBlob;
+    in >> judgingTime;
+    int count, tmp;
+    in >> count;
+    compileState.clear();
+    for (int i = 0; i < count; i ++) {
+        in >> tmp;
+        compileState.append(CompileState(tmp));
+    }
+    in >> count;
+    resultTable.clear();
+    for (int i = 0; i < count; i ++) {
+        ResultTable table;
+        table.readFromStream(in, hasBlobs);
+        resultTable.append(table);
+    }
+    aggregatesValid = false;
+}
+
+void Contestant::writeSummaryToStream(QDataStream &out) const
+{
+    QList<int> taskScore;
+    for (int i = 0; i < checkJudged.size(); i ++) {
+        taskScore.append(getTaskScore(i));
+    }
+    out << contestantName;
+    out << checkJudged;
+    out << judgingTime;
+    out << taskScore;
+    out << getTotalUsedTime();
+}
+
+void Contestant::readSummaryFromStream(QDataStream &in)
+{
+    in >> contestantName;
+    in >> checkJudged;
+    in >> judgingTime;
+    in >> summaryTaskScore;
+    in >> summaryTotalUsedTime;
+    loaded = false;
+    loadFailed = false;
+    aggregatesValid = false;
+}
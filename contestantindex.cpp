@@ -0,0 +1,195 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "contestantindex.h"
+
+static const int debounceInterval = 500;
+
+class ContestantScanThread : public QThread
+{
+public:
+    explicit ContestantScanThread(QObject *parent = 0);
+    QString sourcePath;
+    bool fullScan;
+    bool cancelled;
+    QHash<QString, ContestantIndex::Folder> known;
+    QHash<QString, ContestantIndex::Folder> result;
+
+protected:
+    void run();
+};
+
+ContestantScanThread::ContestantScanThread(QObject *parent) :
+    QThread(parent)
+{
+    fullScan = true;
+    cancelled = false;
+}
+
+void ContestantScanThread::run()
+{
+    result.clear();
+    QFileInfoList list = QDir(sourcePath).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot);
+    for (int i = 0; i < list.size(); i ++) {
+        if (cancelled) return;
+        QString name = list[i].fileName();
+        ContestantIndex::Folder folder;
+        folder.lastModified = list[i].lastModified();
+        // Folders whose own entries did not change keep their fingerprint
+        if (! fullScan && known.contains(name) && known[name].lastModified == folder.lastModified) {
+            folder.fingerprint = known[name].fingerprint;
+        } else {
+            folder.fingerprint = ContestantIndex::fingerprint(sourcePath + name, &cancelled);
+        }
+        result.insert(name, folder);
+    }
+}
+
+ContestantIndex::ContestantIndex(QObject *parent) :
+    QObject(parent)
+{
+    scanThread = new ContestantScanThread(this);
+    connect(scanThread, SIGNAL(finished()),
+            this, SLOT(scanFinished()));
+    watcher = 0;
+    rescanPending = false;
+    rescanRequested = false;
+    debounceTimer = new QTimer(this);
+    debounceTimer->setSingleShot(true);
+    debounceTimer->setInterval(debounceInterval);
+    connect(debounceTimer, SIGNAL(timeout()),
+            this, SLOT(startScan()));
+}
+
+ContestantIndex::~ContestantIndex()
+{
+    scanThread->cancelled = true;
+    scanThread->wait();
+}
+
+void ContestantIndex::setSourcePath(const QString &path)
+{
+    stop();
+    sourcePath = QDir(path).absolutePath() + "/";
+    watcher = new QFileSystemWatcher(this);
+    watcher->addPath(sourcePath);
+    connect(watcher, SIGNAL(directoryChanged(QString)),
+            debounceTimer, SLOT(start()));
+    startScan();
+}
+
+void ContestantIndex::stop()
+{
+    debounceTimer->stop();
+    if (watcher) delete watcher;
+    watcher = 0;
+    rescanPending = false;
+    rescanRequested = false;
+    scanThread->cancelled = true;
+    scanThread->wait();
+    scanThread->cancelled = false;
+    folders.clear();
+}
+
+void ContestantIndex::rescan()
+{
+    debounceTimer->stop();
+    rescanRequested = true;
+    startScan();
+}
+
+bool ContestantIndex::isScanning() const
+{
+    return scanThread->isRunning();
+}
+
+QStringList ContestantIndex::getContestantNames() const
+{
+    return folders.keys();
+}
+
+QByteArray ContestantIndex::getFingerprint(const QString &name) const
+{
+    return folders.value(name).fingerprint;
+}
+
+QByteArray ContestantIndex::fingerprint(const QString &path, const bool *cancelled)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    QDirIterator iter(path, QDir::Files | QDir::Hidden, QDirIterator::Subdirectories);
+    QStringList entries;
+    while (iter.hasNext()) {
+        if (cancelled && *cancelled) return QByteArray();
+        iter.next();
+        QFileInfo info = iter.fileInfo();
+        entries.append(QString("%1\t%2\t%3").arg(info.absoluteFilePath().mid(path.length()))
+                       .arg(info.size()).arg(info.lastModified().toTime_t()));
+    }
+    entries.sort();
+    for (int i = 0; i < entries.size(); i ++) {
+        hash.addData(entries[i].toUtf8());
+        hash.addData("\n", 1);
+    }
+    return hash.result();
+}
+
+void ContestantIndex::startScan()
+{
+    if (! watcher) return;
+    if (scanThread->isRunning()) {
+        rescanPending = true;
+        return;
+    }
+    scanThread->sourcePath = sourcePath;
+    scanThread->known = folders;
+    scanThread->fullScan = rescanRequested;
+    scanThread->cancelled = false;
+    scanThread->start(QThread::LowPriority);
+}
+
+void ContestantIndex::scanFinished()
+{
+    // A cancelled scan may still report after a new one was started
+    if (! watcher || scanThread->isRunning()) return;
+    
+    QHash<QString, Folder> result = scanThread->result;
+    QStringList added, removed, modified;
+    QHash<QString, Folder>::const_iterator iter;
+    for (iter = result.constBegin(); iter != result.constEnd(); ++ iter) {
+        if (! folders.contains(iter.key())) {
+            added.append(iter.key());
+        } else if (folders.value(iter.key()).fingerprint != iter.value().fingerprint) {
+            modified.append(iter.key());
+        }
+    }
+    for (iter = folders.constBegin(); iter != folders.constEnd(); ++ iter) {
+        if (! result.contains(iter.key())) removed.append(iter.key());
+    }
+    folders = result;
+    
+    if (rescanPending) {
+        rescanPending = false;
+        startScan();
+    }
+    if (! added.isEmpty() || ! removed.isEmpty() || ! modified.isEmpty()) {
+        emit indexChanged(added, removed, modified);
+    }
+    if (rescanRequested && ! rescanPending && ! scanThread->isRunning()) {
+        rescanRequested = false;
+        emit rescanFinished();
+    }
+}
@@ -0,0 +1,63 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef CONTESTANTINDEX_H
+#define CONTESTANTINDEX_H
+
+#include <QtCore>
+#include <QObject>
+
+class ContestantScanThread;
+
+class ContestantIndex : public QObject
+{
+    Q_OBJECT
+public:
+    struct Folder {
+        QDateTime lastModified;
+        QByteArray fingerprint;
+    };
+    
+    explicit ContestantIndex(QObject *parent = 0);
+    ~ContestantIndex();
+    void setSourcePath(const QString&);
+    void stop();
+    void rescan();
+    bool isScanning() const;
+    QStringList getContestantNames() const;
+    QByteArray getFingerprint(const QString&) const;
+    static QByteArray fingerprint(const QString&, const bool* = 0);
+
+private:
+    ContestantScanThread *scanThread;
+    QFileSystemWatcher *watcher;
+    QTimer *debounceTimer;
+    QString sourcePath;
+    QHash<QString, Folder> folders;
+    bool rescanPending;
+    bool rescanRequested;
+
+private slots:
+    void startScan();
+    void scanFinished();
+
+signals:
+    void indexChanged(const QStringList&, const QStringList&, const QStringList&);
+    void rescanFinished();
+};
+
+#endif // CONTESTANTINDEX_H
@@ -0,0 +1,538 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include "contestfile.h"
+#include "contest.h"
+#include "contestant.h"
+#include "task.h"
+#ifdef Q_OS_WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <cstdio>
+#include <unistd.h>
+#endif
+
+static const int maxLogLength = 64;
+
+FileChunk::FileChunk()
+{
+    offset = -1;
+    length = 0;
+    checksum = 0;
+}
+
+ContestFile::ContestFile(QObject *parent) :
+    QObject(parent)
+{
+}
+
+ContestSnapshot::ContestSnapshot()
+{
+    chunkFileGarbage = 0;
+    indexOffset = -1;
+    logLength = 0;
+}
+
+ContestSnapshot::~ContestSnapshot()
+{
+    for (int i = 0; i < entries.size(); i ++) {
+        delete entries[i].copy;
+    }
+}
+
+ContestFile::Status ContestFile::save(Contest *contest, const QString &fileName)
+{
+    ContestSnapshot *snapshot = takeSnapshot(contest, fileName);
+    Status status = writeSnapshot(snapshot);
+    if (status == Succeeded) status = applySnapshot(contest, snapshot);
+    delete snapshot;
+    return status;
+}
+
+ContestFile::Status ContestFile::load(Contest *contest, const QString &fileName)
+{
+    QFile file(QFileInfo(fileName).absoluteFilePath());
+    if (! file.open(QFile::ReadOnly)) return CannotOpenFile;
+    
+    QDataStream in(&file);
+    unsigned checkNumber;
+    in >> checkNumber;
+    if (checkNumber == unsigned(MagicNumber)) return loadLegacy(contest, file);
+    if (checkNumber == unsigned(ChunkedMagicNumber)) return loadChunked(contest, file);
+    return BrokenFile;
+}
+
+bool ContestFile::readChunk(const QString &fileName, const FileChunk &chunk, QByteArray &data)
+{
+    QFile file(fileName);
+    if (! file.open(QFile::ReadOnly)) return false;
+    if (! readRawChunk(file, chunk, data)) return false;
+    data = qUncompress(data);
+    return ! data.isEmpty();
+}
+
+bool ContestFile::replaceFile(const QString &source, const QString &target)
+{
+#ifdef Q_OS_WIN32
+    return MoveFileExW((const WCHAR*)(QDir::toNativeSeparators(source).utf16()),
+                       (const WCHAR*)(QDir::toNativeSeparators(target).utf16()),
+                       MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return ::rename(QFile::encodeName(source).constData(), QFile::encodeName(target).constData()) == 0;
+#endif
+}
+
+void ContestFile::syncFile(QFile &file)
+{
+    file.flush();
+#ifdef Q_OS_WIN32
+    FlushFileBuffers((HANDLE)_get_osfhandle(file.handle()));
+#else
+    fsync(file.handle());
+#endif
+}
+
+ContestFile::Status ContestFile::loadLegacy(Contest *contest, QFile &file)
+{
+    QDataStream _in(&file);
+    quint16 checksum;
+    int len;
+    _in >> checksum >> len;
+    if (len < 0) return BrokenFile;
+    char *raw = new char[len];
+    _in.readRawData(raw, len);
+    if (qChecksum(raw, len) != checksum) {
+        delete[] raw;
+        return BrokenFile;
+    }
+    
+    QByteArray data(raw, len);
+    delete[] raw;
+    data = qUncompress(data);
+    QDataStream in(data);
+    contest->readFromStream(in);
+    return Succeeded;
+}
+
+ContestFile::Status ContestFile::loadChunked(Contest *contest, QFile &file)
+{
+    QDataStream _in(&file);
+    quint32 version;
+    qint64 indexOffset;
+    _in >> version >> indexOffset;
+    if (version != 1 && version != 2) return BrokenFile;
+    
+    QList<QByteArray> records;
+    qint64 liveSize = headerSize();
+    qint64 offset = indexOffset;
+    while (offset != -1) {
+        QByteArray data;
+        if (! readIndexBlock(file, offset, data)) return BrokenFile;
+        liveSize += file.pos() - offset;
+        records.prepend(data);
+        qint64 previous = -1;
+        if (version == 2) {
+            QDataStream in(data);
+            in >> previous;
+        }
+        if (previous >= offset) return BrokenFile;
+        offset = previous;
+    }
+    
+    QString filePath = QFileInfo(file).absoluteFilePath();
+    QList<FileChunk> taskChunks;
+    QList<QByteArray> taskHashes;
+    QMap<QString, FileChunk> contestantChunks;
+    QMap<QString, Contestant*> contestantList;
+    for (int k = 0; k < records.size(); k ++) {
+        QDataStream in(records[k]);
+        qint64 previous;
+        bool tasksChanged = true;
+        QStringList removedContestants;
+        int count;
+        if (version == 2) in >> previous;
+        in >> contest->contestTitle;
+        if (version == 2) in >> tasksChanged;
+        if (tasksChanged) {
+            taskChunks.clear();
+            taskHashes.clear();
+            in >> count;
+            for (int i = 0; i < count; i ++) {
+                FileChunk chunk;
+                QByteArray hash;
+                readChunkInfo(in, chunk);
+                in >> hash;
+                taskChunks.append(chunk);
+                taskHashes.append(hash);
+            }
+        }
+        if (version == 2) in >> removedContestants;
+        for (int i = 0; i < removedContestants.size(); i ++) {
+            delete contestantList.take(removedContestants[i]);
+            contestantChunks.remove(removedContestants[i]);
+        }
+        in >> count;
+        for (int i = 0; i < count; i ++) {
+            FileChunk chunk;
+            readChunkInfo(in, chunk);
+            Contestant *newContestant = new Contestant(contest);
+            newContestant->readSummaryFromStream(in);
+            newContestant->setChunk(filePath, chunk);
+            QString name = newContestant->getContestantName();
+            delete contestantList.value(name, 0);
+            contestantList.insert(name, newContestant);
+            contestantChunks.insert(name, chunk);
+        }
+        contest->markContestantsChanged();
+        if (in.status() != QDataStream::Ok) {
+            qDeleteAll(contestantList);
+            return BrokenFile;
+        }
+    }
+    
+    for (int i = 0; i < taskChunks.size(); i ++) {
+        QByteArray taskData;
+        if (! readRawChunk(file, taskChunks[i], taskData)) {
+            qDeleteAll(contestantList);
+            return BrokenFile;
+        }
+        taskData = qUncompress(taskData);
+        QDataStream taskIn(taskData);
+        Task *newTask = new Task(contest);
+        newTask->readFromStream(taskIn);
+        newTask->refreshCompilerConfiguration(contest->settings);
+        contest->taskList.append(newTask);
+        liveSize += taskChunks[i].length;
+    }
+    
+    QMap<QString, Contestant*>::const_iterator i;
+    for (i = contestantList.constBegin(); i != contestantList.constEnd(); ++ i) {
+        connect(contest, SIGNAL(taskAddedForContestant()),
+                i.value(), SLOT(addTask()));
+        connect(contest, SIGNAL(taskDeletedForContestant(int)),
+                i.value(), SLOT(deleteTask(int)));
+        liveSize += contestantChunks[i.key()].length;
+    }
+    
+    contest->contestantList = contestantList;
+    contest->taskChunks = taskChunks;
+    contest->taskChunkHashes = taskHashes;
+    contest->contestantChunks = contestantChunks;
+    contest->chunkFileName = filePath;
+    contest->chunkFileIndexOffset = indexOffset;
+    // version 1 files have a single full index; compact them on the next save
+    contest->chunkFileLogLength = version == 2 ? records.size() - 1 : maxLogLength;
+    contest->chunkFileGarbage = qMax(qint64(0), file.size() - liveSize);
+    return Succeeded;
+}
+
+bool ContestFile::readIndexBlock(QFile &file, qint64 offset, QByteArray &data)
+{
+    if (offset < headerSize() || offset >= file.size()) return false;
+    if (! file.seek(offset)) return false;
+    QDataStream in(&file);
+    quint16 checksum;
+    int len;
+    in >> checksum >> len;
+    if (len < 0) return false;
+    QByteArray raw = file.read(len);
+    if (raw.size() != len || qChecksum(raw.data(), len) != checksum) return false;
+    data = qUncompress(raw);
+    return ! data.isEmpty();
+}
+
+ContestSnapshot* ContestFile::takeSnapshot(Contest *contest, const QString &fileName)
+{
+    ContestSnapshot *snapshot = new ContestSnapshot;
+    snapshot->fileName = QFileInfo(fileName).absoluteFilePath();
+    snapshot->contestTitle = contest->getContestTitle();
+    snapshot->oldTaskChunks = contest->taskChunks;
+    snapshot->oldTaskHashes = contest->taskChunkHashes;
+    snapshot->chunkFileName = contest->chunkFileName;
+    snapshot->chunkFileGarbage = contest->chunkFileGarbage;
+    snapshot->indexOffset = contest->chunkFileIndexOffset;
+    snapshot->logLength = contest->chunkFileLogLength;
+    snapshot->contestantChunks = contest->contestantChunks;
+    
+    const QList<Task*> &taskList = contest->getTaskList();
+    for (int i = 0; i < taskList.size(); i ++) {
+        QByteArray data;
+        QDataStream out(&data, QIODevice::WriteOnly);
+        taskList[i]->writeToStream(out);
+        snapshot->taskData.append(data);
+    }
+    
+    QList<Contestant*> contestantList = contest->getContestantList();
+    for (int i = 0; i < contestantList.size(); i ++) {
+        ContestSnapshot::Entry entry;
+        entry.contestant = contestantList[i];
+        entry.name = contestantList[i]->getContestantName();
+        entry.revision = contestantList[i]->getRevision();
+        QDataStream out(&entry.summary, QIODevice::WriteOnly);
+        contestantList[i]->writeSummaryToStream(out);
+        entry.copy = 0;
+        entry.chunkFile = contestantList[i]->getChunkFile();
+        entry.chunk = contestantList[i]->getChunk();
+        if (contestantList[i]->isDirty() || entry.chunkFile != contest->chunkFileName) {
+            entry.copy = new Contestant;
+            entry.copy->copyFrom(contestantList[i]);
+        }
+        snapshot->entries.append(entry);
+    }
+    
+    QStringList storedNames = contest->contestantChunks.keys();
+    for (int i = 0; i < storedNames.size(); i ++) {
+        if (! contest->contestantList.contains(storedNames[i])) {
+            snapshot->removedContestants.append(storedNames[i]);
+        }
+    }
+    
+    return snapshot;
+}
+
+ContestFile::Status ContestFile::writeSnapshot(ContestSnapshot *snapshot)
+{
+    snapshot->taskHashes.clear();
+    for (int i = 0; i < snapshot->taskData.size(); i ++) {
+        snapshot->taskHashes.append(QCryptographicHash::hash(snapshot->taskData[i], QCryptographicHash::Sha1));
+    }
+    
+    if (snapshot->chunkFileName == snapshot->fileName && snapshot->logLength < maxLogLength
+            && isChunkedFile(snapshot->fileName)) {
+        Status status = appendChunks(snapshot);
+        if (status != Succeeded) return status;
+        if (snapshot->chunkFileGarbage * 2 <= QFileInfo(snapshot->fileName).size()) return Succeeded;
+    }
+    return rewrite(snapshot);
+}
+
+ContestFile::Status ContestFile::applySnapshot(Contest *contest, ContestSnapshot *snapshot)
+{
+    if (! snapshot->tempFileName.isEmpty()) {
+        if (! replaceFile(snapshot->tempFileName, snapshot->fileName)) {
+            QFile::remove(snapshot->tempFileName);
+            return CannotOpenFile;
+        }
+    }
+    
+    contest->taskChunks = snapshot->taskChunks;
+    contest->taskChunkHashes = snapshot->taskHashes;
+    contest->contestantChunks = snapshot->contestantChunks;
+    contest->chunkFileName = snapshot->fileName;
+    contest->chunkFileGarbage = snapshot->chunkFileGarbage;
+    contest->chunkFileIndexOffset = snapshot->indexOffset;
+    contest->chunkFileLogLength = snapshot->logLength;
+    for (int i = 0; i < snapshot->entries.size(); i ++) {
+        Contestant *contestant = snapshot->entries[i].contestant;
+        if (contestant && contestant->getRevision() == snapshot->entries[i].revision) {
+            contestant->setChunk(snapshot->fileName, snapshot->entries[i].newChunk);
+        }
+    }
+    return Succeeded;
+}
+
+ContestFile::Status ContestFile::appendChunks(ContestSnapshot *snapshot)
+{
+    QFile file(snapshot->fileName);
+    if (! file.open(QFile::ReadWrite)) return CannotOpenFile;
+    file.seek(file.size());
+    
+    qint64 garbage = snapshot->chunkFileGarbage;
+    snapshot->taskChunks.clear();
+    for (int i = 0; i < snapshot->taskData.size(); i ++) {
+        int k = snapshot->oldTaskHashes.indexOf(snapshot->taskHashes[i]);
+        if (k != -1) {
+            snapshot->taskChunks.append(snapshot->oldTaskChunks[k]);
+        } else {
+            snapshot->taskChunks.append(writeRawChunk(file, qCompress(snapshot->taskData[i])));
+        }
+    }
+    for (int i = 0; i < snapshot->oldTaskHashes.size(); i ++) {
+        if (! snapshot->taskHashes.contains(snapshot->oldTaskHashes[i])) {
+            garbage += snapshot->oldTaskChunks[i].length;
+        }
+    }
+    
+    for (int i = 0; i < snapshot->removedContestants.size(); i ++) {
+        garbage += snapshot->contestantChunks.take(snapshot->removedContestants[i]).length;
+    }
+    for (int i = 0; i < snapshot->entries.size(); i ++) {
+        ContestSnapshot::Entry &entry = snapshot->entries[i];
+        if (entry.copy) {
+            if (snapshot->contestantChunks.contains(entry.name)) {
+                garbage += snapshot->contestantChunks[entry.name].length;
+            }
+            entry.newChunk = writeRawChunk(file, qCompress(serialize(entry.copy)));
+            snapshot->contestantChunks.insert(entry.name, entry.newChunk);
+        } else {
+            entry.newChunk = entry.chunk;
+        }
+    }
+    
+    qint64 indexOffset = file.pos();
+    writeIndex(file, snapshot, false);
+    if (! file.flush()) return CannotOpenFile;
+    // The chunks and index must be on disk before the header points at them
+    syncFile(file);
+    file.seek(sizeof(quint32));
+    QDataStream out(&file);
+    out << quint32(2) << indexOffset;
+    if (! file.flush()) return CannotOpenFile;
+    syncFile(file);
+    
+    snapshot->indexOffset = indexOffset;
+    snapshot->logLength ++;
+    snapshot->chunkFileGarbage = garbage;
+    return Succeeded;
+}
+
+ContestFile::Status ContestFile::rewrite(ContestSnapshot *snapshot)
+{
+    QString tempPath = snapshot->fileName + ".tmp";
+    QFile file(tempPath);
+    if (! file.open(QFile::WriteOnly | QFile::Truncate)) return CannotOpenFile;
+    QDataStream out(&file);
+    out << quint32(ChunkedMagicNumber) << quint32(2) << qint64(0);
+    
+    snapshot->taskChunks.clear();
+    for (int i = 0; i < snapshot->taskData.size(); i ++) {
+        snapshot->taskChunks.append(writeRawChunk(file, qCompress(snapshot->taskData[i])));
+    }
+    
+    QFile source(snapshot->chunkFileName);
+    if (! snapshot->chunkFileName.isEmpty()) source.open(QFile::ReadOnly);
+    snapshot->contestantChunks.clear();
+    for (int i = 0; i < snapshot->entries.size(); i ++) {
+        ContestSnapshot::Entry &entry = snapshot->entries[i];
+        QByteArray raw;
+        if (entry.copy) {
+            raw = qCompress(serialize(entry.copy));
+        } else if (! source.isOpen() || ! readRawChunk(source, entry.chunk, raw)) {
+            file.close();
+            QFile::remove(tempPath);
+            return BrokenFile;
+        }
+        entry.newChunk = writeRawChunk(file, raw);
+        snapshot->contestantChunks.insert(entry.name, entry.newChunk);
+    }
+    source.close();
+    
+    qint64 indexOffset = file.pos();
+    writeIndex(file, snapshot, true);
+    file.seek(sizeof(quint32) * 2);
+    out << indexOffset;
+    syncFile(file);
+    file.close();
+    if (file.error() != QFile::NoError) {
+        QFile::remove(tempPath);
+        return CannotOpenFile;
+    }
+    
+    snapshot->tempFileName = tempPath;
+    snapshot->indexOffset = indexOffset;
+    snapshot->logLength = 0;
+    snapshot->chunkFileGarbage = 0;
+    return Succeeded;
+}
+
+bool ContestFile::isChunkedFile(const QString &fileName)
+{
+    QFile file(fileName);
+    if (! file.open(QFile::ReadOnly)) return false;
+    QDataStream in(&file);
+    unsigned checkNumber;
+    in >> checkNumber;
+    return checkNumber == unsigned(ChunkedMagicNumber);
+}
+
+bool ContestFile::readRawChunk(QFile &file, const FileChunk &chunk, QByteArray &raw)
+{
+    if (chunk.offset < headerSize() || chunk.length < 0) return false;
+    if (! file.seek(chunk.offset)) return false;
+    raw = file.read(chunk.length);
+    if (raw.size() != chunk.length) return false;
+    return qChecksum(raw.data(), raw.size()) == chunk.checksum;
+}
+
+FileChunk ContestFile::writeRawChunk(QFile &file, const QByteArray &raw)
+{
+    FileChunk chunk;
+    chunk.offset = file.pos();
+    chunk.length = raw.size();
+    chunk.checksum = qChecksum(raw.data(), raw.size());
+    file.write(raw);
+    return chunk;
+}
+
+QByteArray ContestFile::serialize(Contestant *contestant)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    contestant->writeCompactToStream(out);
+    return data;
+}
+
+void ContestFile::writeIndex(QFile &file, ContestSnapshot *snapshot, bool full)
+{
+    QByteArray data;
+    QDataStream _out(&data, QIODevice::WriteOnly);
+    bool tasksChanged = full || snapshot->taskHashes != snapshot->oldTaskHashes;
+    _out << (full ? qint64(-1) : snapshot->indexOffset);
+    _out << snapshot->contestTitle;
+    _out << tasksChanged;
+    if (tasksChanged) {
+        _out << snapshot->taskChunks.size();
+        for (int i = 0; i < snapshot->taskChunks.size(); i ++) {
+            writeChunkInfo(_out, snapshot->taskChunks[i]);
+            _out << snapshot->taskHashes[i];
+        }
+    }
+    _out << (full ? QStringList() : snapshot->removedContestants);
+    
+    QList<int> entryList;
+    for (int i = 0; i < snapshot->entries.size(); i ++) {
+        if (full || snapshot->entries[i].copy) entryList.append(i);
+    }
+    _out << entryList.size();
+    for (int i = 0; i < entryList.size(); i ++) {
+        const ContestSnapshot::Entry &entry = snapshot->entries[entryList[i]];
+        writeChunkInfo(_out, entry.newChunk);
+        _out.writeRawData(entry.summary.data(), entry.summary.size());
+    }
+    
+    data = qCompress(data);
+    QDataStream out(&file);
+    out << qChecksum(data.data(), data.length()) << data.length();
+    out.writeRawData(data.data(), data.length());
+}
+
+void ContestFile::writeChunkInfo(QDataStream &out, const FileChunk &chunk)
+{
+    out << chunk.offset << chunk.length << chunk.checksum;
+}
+
+void ContestFile::readChunkInfo(QDataStream &in, FileChunk &chunk)
+{
+    in >> chunk.offset >> chunk.length >> chunk.checksum;
+}
+
+qint64 ContestFile::headerSize()
+{
+    return sizeof(quint32) * 2 + sizeof(qint64);
+}
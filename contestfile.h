@@ -0,0 +1,103 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#ifndef CONTESTFILE_H
+#define CONTESTFILE_H
+
+#include <QtCore>
+#include <QObject>
+#include <QPointer>
+#define ChunkedMagicNumber 0x20130410
+
+class Contest;
+class Contestant;
+
+struct FileChunk
+{
+    FileChunk();
+    qint64 offset;
+    int length;
+    quint16 checksum;
+};
+
+struct ContestSnapshot
+{
+    struct Entry
+    {
+        QPointer<Contestant> contestant;
+        QString name;
+        quint32 revision;
+        QByteArray summary;
+        Contestant *copy;
+        QString chunkFile;
+        FileChunk chunk;
+        FileChunk newChunk;
+    };
+    
+    ContestSnapshot();
+    ~ContestSnapshot();
+    QString fileName;
+    QString tempFileName;
+    QString contestTitle;
+    QList<QByteArray> taskData;
+    QList<QByteArray> taskHashes;
+    QList<FileChunk> taskChunks;
+    QList<QByteArray> oldTaskHashes;
+    QList<FileChunk> oldTaskChunks;
+    QString chunkFileName;
+    qint64 chunkFileGarbage;
+    qint64 indexOffset;
+    int logLength;
+    QMap<QString, FileChunk> contestantChunks;
+    QStringList removedContestants;
+    QList<Entry> entries;
+};
+
+class ContestFile : public QObject
+{
+    Q_OBJECT
+public:
+    enum Status { Succeeded, CannotOpenFile, BrokenFile };
+    
+    explicit ContestFile(QObject *parent = 0);
+    static Status save(Contest*, const QString&);
+    static Status load(Contest*, const QString&);
+    static ContestSnapshot* takeSnapshot(Contest*, const QString&);
+    static Status writeSnapshot(ContestSnapshot*);
+    static Status applySnapshot(Contest*, ContestSnapshot*);
+    static bool readChunk(const QString&, const FileChunk&, QByteArray&);
+    static bool replaceFile(const QString&, const QString&);
+    static void syncFile(QFile&);
+
+private:
+    static Status loadLegacy(Contest*, QFile&);
+    static Status loadChunked(Contest*, QFile&);
+    static bool readIndexBlock(QFile&, qint64, QByteArray&);
+    static Status appendChunks(ContestSnapshot*);
+    static Status rewrite(ContestSnapshot*);
+    static bool isChunkedFile(const QString&);
+    static bool readRawChunk(QFile&, const FileChunk&, QByteArray&);
+    static FileChunk writeRawChunk(QFile&, const QByteArray&);
+    static QByteArray serialize(Contestant*);
+    static void writeIndex(QFile&, ContestSnapshot*, bool);
+    static void writeChunkInfo(QDataStream&, const FileChunk&);
+    static void readChunkInfo(QDataStream&, FileChunk&);
+    static qint64 headerSize();
+};
+
+#endif // CONTESTFILE_H
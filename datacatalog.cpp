@@ -0,0 +1,265 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "datacatalog.h"
+#include "judgingcache.h"
+#include "contestfile.h"
+
+class DataCatalogThread : public QThread
+{
+public:
+    DataCatalogThread(DataCatalog*);
+
+protected:
+    void run();
+
+private:
+    DataCatalog *catalog;
+};
+
+DataCatalogThread::DataCatalogThread(DataCatalog *_catalog)
+{
+    catalog = _catalog;
+}
+
+void DataCatalogThread::run()
+{
+    catalog->processPendingFiles();
+}
+
+DataCatalog::DataCatalog(QObject *parent) :
+    QObject(parent)
+{
+    thread = new DataCatalogThread(this);
+    connect(thread, SIGNAL(finished()), this, SLOT(refreshFinished()));
+    rootPath = QDir::currentPath();
+    modified = false;
+    cancelled = false;
+}
+
+DataCatalog::~DataCatalog()
+{
+    close();
+    delete thread;
+}
+
+QString DataCatalog::catalogFileName(const QString &contestFileName)
+{
+    return QFileInfo(contestFileName).absoluteFilePath() + ".catalog";
+}
+
+bool DataCatalog::open(const QString &_fileName, const QString &path)
+{
+    close();
+    fileName = _fileName;
+    rootPath = QDir(path).absolutePath();
+    
+    QFile file(fileName);
+    if (! file.exists()) return true;
+    if (! file.open(QFile::ReadOnly)) return false;
+    
+    QDataStream in(&file);
+    unsigned checkNumber;
+    in >> checkNumber;
+    if (checkNumber != unsigned(CatalogMagicNumber)) return false;
+    int count;
+    in >> count;
+    
+    QMutexLocker locker(&mutex);
+    for (int i = 0; i < count; i ++) {
+        QString key;
+        Entry entry;
+        in >> key >> entry.size >> entry.lastModified >> entry.hash;
+        if (in.status() != QDataStream::Ok) {
+            entries.clear();
+            return false;
+        }
+        entries.insert(key, entry);
+    }
+    return true;
+}
+
+bool DataCatalog::save()
+{
+    if (fileName.isEmpty()) return false;
+    QMutexLocker locker(&mutex);
+    if (! modified) return true;
+    
+    QString tempPath = fileName + ".tmp";
+    QFile file(tempPath);
+    if (! file.open(QFile::WriteOnly)) return false;
+    QDataStream out(&file);
+    out << unsigned(CatalogMagicNumber) << entries.size();
+    QHash<QString, Entry>::const_iterator iter;
+    for (iter = entries.constBegin(); iter != entries.constEnd(); ++ iter) {
+        out << iter.key() << iter->size << iter->lastModified << iter->hash;
+    }
+    file.close();
+    if (out.status() != QDataStream::Ok) {
+        QFile::remove(tempPath);
+        return false;
+    }
+    
+    if (! ContestFile::replaceFile(tempPath, fileName)) {
+        QFile::remove(tempPath);
+        return false;
+    }
+    modified = false;
+    return true;
+}
+
+void DataCatalog::close()
+{
+    mutex.lock();
+    cancelled = true;
+    mutex.unlock();
+    thread->wait();
+    save();
+    
+    QMutexLocker locker(&mutex);
+    fileName.clear();
+    entries.clear();
+    trackedFiles.clear();
+    pendingFiles.clear();
+    modified = false;
+    cancelled = false;
+}
+
+// Only files that were not tracked before are checked here; changes to
+// tracked files reach the catalog through refresh().
+void DataCatalog::setTrackedFiles(const QStringList &fileNames)
+{
+    mutex.lock();
+    QSet<QString> newTrackedFiles;
+    for (int i = 0; i < fileNames.size(); i ++) {
+        QString key = keyOf(fileNames[i]);
+        newTrackedFiles.insert(key);
+        if (! trackedFiles.contains(key)) pendingFiles.insert(key);
+    }
+    trackedFiles = newTrackedFiles;
+    pendingFiles.intersect(trackedFiles);
+    QStringList keys = entries.keys();
+    for (int i = 0; i < keys.size(); i ++) {
+        if (! trackedFiles.contains(keys[i])) {
+            entries.remove(keys[i]);
+            modified = true;
+        }
+    }
+    mutex.unlock();
+    startRefreshing();
+}
+
+void DataCatalog::refresh(const QStringList &fileNames)
+{
+    mutex.lock();
+    for (int i = 0; i < fileNames.size(); i ++) {
+        QString key = keyOf(fileNames[i]);
+        if (trackedFiles.contains(key)) pendingFiles.insert(key);
+    }
+    mutex.unlock();
+    startRefreshing();
+}
+
+void DataCatalog::wait()
+{
+    while (true) {
+        thread->wait();
+        QMutexLocker locker(&mutex);
+        if (pendingFiles.isEmpty() || cancelled) return;
+        locker.unlock();
+        startRefreshing();
+    }
+}
+
+bool DataCatalog::lookUp(const QString &name, Entry &entry) const
+{
+    QMutexLocker locker(&mutex);
+    QHash<QString, Entry>::const_iterator iter = entries.constFind(keyOf(name));
+    if (iter == entries.constEnd()) return false;
+    entry = *iter;
+    return true;
+}
+
+QByteArray DataCatalog::getFileHash(const QString &name) const
+{
+    QFileInfo info(name);
+    if (! info.exists()) return QByteArray();
+    Entry entry;
+    if (! lookUp(info.absoluteFilePath(), entry)) return QByteArray();
+    if (entry.size != info.size() || entry.lastModified != info.lastModified()) return QByteArray();
+    return entry.hash;
+}
+
+int DataCatalog::size() const
+{
+    QMutexLocker locker(&mutex);
+    return entries.size();
+}
+
+QString DataCatalog::keyOf(const QString &name) const
+{
+    return QDir(rootPath).relativeFilePath(QFileInfo(name).absoluteFilePath());
+}
+
+void DataCatalog::startRefreshing()
+{
+    QMutexLocker locker(&mutex);
+    if (pendingFiles.isEmpty() || cancelled) return;
+    locker.unlock();
+    if (! thread->isRunning()) thread->start(QThread::LowPriority);
+}
+
+void DataCatalog::processPendingFiles()
+{
+    QDir root(rootPath);
+    while (true) {
+        mutex.lock();
+        if (cancelled || pendingFiles.isEmpty()) {
+            mutex.unlock();
+            return;
+        }
+        QString key = *pendingFiles.begin();
+        pendingFiles.erase(pendingFiles.begin());
+        bool known = entries.contains(key);
+        Entry entry;
+        if (known) entry = entries.value(key);
+        mutex.unlock();
+        
+        QFileInfo info(root.filePath(key));
+        if (! info.exists()) {
+            QMutexLocker locker(&mutex);
+            if (entries.remove(key) > 0) modified = true;
+            continue;
+        }
+        if (known && entry.size == info.size() && entry.lastModified == info.lastModified()) continue;
+        
+        Entry newEntry;
+        newEntry.size = info.size();
+        newEntry.lastModified = info.lastModified();
+        newEntry.hash = JudgingCache::hashFile(info.absoluteFilePath());
+        if (newEntry.hash.isEmpty()) continue;
+        
+        QMutexLocker locker(&mutex);
+        entries.insert(key, newEntry);
+        modified = true;
+    }
+}
+
+void DataCatalog::refreshFinished()
+{
+    startRefreshing();
+}
@@ -0,0 +1,70 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef DATACATALOG_H
+#define DATACATALOG_H
+
+#include <QtCore>
+#include <QObject>
+#include "filehashsource.h"
+#define CatalogMagicNumber 0x20130501
+
+class DataCatalogThread;
+
+class DataCatalog : public QObject, public FileHashSource
+{
+    Q_OBJECT
+    friend class DataCatalogThread;
+public:
+    struct Entry {
+        qint64 size;
+        QDateTime lastModified;
+        QByteArray hash;
+    };
+    
+    explicit DataCatalog(QObject *parent = 0);
+    ~DataCatalog();
+    bool open(const QString&, const QString&);
+    bool save();
+    void close();
+    void setTrackedFiles(const QStringList&);
+    void refresh(const QStringList&);
+    void wait();
+    bool lookUp(const QString&, Entry&) const;
+    QByteArray getFileHash(const QString&) const;
+    int size() const;
+    static QString catalogFileName(const QString&);
+
+private:
+    DataCatalogThread *thread;
+    QString fileName;
+    QString rootPath;
+    mutable QMutex mutex;
+    QHash<QString, Entry> entries;
+    QSet<QString> trackedFiles;
+    QSet<QString> pendingFiles;
+    bool modified;
+    bool cancelled;
+    QString keyOf(const QString&) const;
+    void startRefreshing();
+    void processPendingFiles();
+
+private slots:
+    void refreshFinished();
+};
+
+#endif // DATACATALOG_H
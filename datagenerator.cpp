@@ -0,0 +1,149 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "datagenerator.h"
+#include "judgingcache.h"
+#include "settings.h"
+
+static const int generatorTimeLimit = 600000;
+static const char generatorHeader[] = "#lemon-generator";
+
+DataGenerator::DataGenerator(QObject *parent) :
+    QObject(parent)
+{
+}
+
+DataGenerator::~DataGenerator()
+{
+    clear();
+}
+
+bool DataGenerator::isGenerated(const QString &fileName)
+{
+    if (! fileName.endsWith(".gen", Qt::CaseInsensitive)) return false;
+    // A real data file may end with .gen too, so require the header line
+    QFile file(fileName);
+    if (! file.open(QFile::ReadOnly)) return false;
+    return file.readLine(64).trimmed() == generatorHeader;
+}
+
+QString DataGenerator::generatedName(const QString &fileName)
+{
+    if (! isGenerated(fileName)) return fileName;
+    return fileName.left(fileName.length() - 4);
+}
+
+bool DataGenerator::readSpecification(const QString &fileName, QString &program, QStringList &arguments)
+{
+    QFile file(fileName);
+    if (! file.open(QFile::ReadOnly | QFile::Text)) return false;
+    QTextStream in(&file);
+    while (! in.atEnd()) {
+        QString line = in.readLine().trimmed();
+        if (line.isEmpty() || line.startsWith('#')) continue;
+        QStringList list = line.split(QRegExp("\\s+"), QString::SkipEmptyParts);
+        program = QFileInfo(Settings::dataPath() + list.takeFirst()).absoluteFilePath();
+        arguments = list;
+        return true;
+    }
+    return false;
+}
+
+QString DataGenerator::materialize(const QString &fileName)
+{
+    QString program;
+    QStringList arguments;
+    if (! readSpecification(fileName, program, arguments)) return QString();
+    
+    QMutexLocker locker(&mutex);
+    QByteArray key = getKey(program, arguments);
+    if (key.isEmpty()) return QString();
+    while (runningKeys.contains(key)) generatorFinished.wait(&mutex);
+    if (generatedFiles.contains(key)) return generatedFiles.value(key);
+    
+    if (directory.isEmpty()) {
+        directory = QDir(QDir::tempPath()).absoluteFilePath(QString("lemon-generated-%1")
+                                                            .arg(QCoreApplication::applicationPid()));
+        QDir().mkpath(directory);
+    }
+    QString workingDirectory = directory;
+    QString target = QDir(directory).absoluteFilePath(QString(key.toHex()) + "_"
+                                                      + QFileInfo(generatedName(fileName)).fileName());
+    runningKeys.insert(key);
+    locker.unlock();
+    
+    bool succeeded = runGenerator(program, arguments, target, workingDirectory);
+    
+    locker.relock();
+    runningKeys.remove(key);
+    // A failed run is retried by the next request instead of being remembered
+    if (succeeded) {
+        generatedFiles.insert(key, target);
+    } else {
+        QFile::remove(target);
+    }
+    generatorFinished.wakeAll();
+    return target;
+}
+
+void DataGenerator::clear()
+{
+    QMutexLocker locker(&mutex);
+    while (! runningKeys.isEmpty()) generatorFinished.wait(&mutex);
+    QHash<QByteArray, QString>::const_iterator iter;
+    for (iter = generatedFiles.constBegin(); iter != generatedFiles.constEnd(); ++ iter) {
+        QFile::remove(iter.value());
+    }
+    if (! directory.isEmpty()) QDir().rmdir(directory);
+    directory.clear();
+    generatedFiles.clear();
+    generatorHashes.clear();
+}
+
+QByteArray DataGenerator::getKey(const QString &program, const QStringList &arguments)
+{
+    QByteArray programHash = generatorHashes.value(program);
+    if (programHash.isEmpty()) {
+        programHash = JudgingCache::hashFile(program);
+        if (programHash.isEmpty()) return QByteArray();
+        generatorHashes.insert(program, programHash);
+    }
+    
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(programHash);
+    for (int i = 0; i < arguments.size(); i ++) {
+        hash.addData(arguments[i].toUtf8());
+        hash.addData("", 1);
+    }
+    return hash.result();
+}
+
+bool DataGenerator::runGenerator(const QString &program, const QStringList &arguments,
+                                 const QString &target, const QString &workingDirectory)
+{
+    QProcess process;
+    process.setWorkingDirectory(workingDirectory);
+    process.setStandardOutputFile(target);
+    process.start(program, arguments);
+    if (! process.waitForStarted(-1)) return false;
+    if (! process.waitForFinished(generatorTimeLimit)) {
+        process.kill();
+        process.waitForFinished(-1);
+        return false;
+    }
+    return process.exitStatus() == QProcess::NormalExit && process.exitCode() == 0;
+}
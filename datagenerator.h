@@ -0,0 +1,47 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef DATAGENERATOR_H
+#define DATAGENERATOR_H
+
+#include <QtCore>
+#include <QObject>
+
+class DataGenerator : public QObject
+{
+    Q_OBJECT
+public:
+    explicit DataGenerator(QObject *parent = 0);
+    ~DataGenerator();
+    QString materialize(const QString&);
+    void clear();
+    static bool isGenerated(const QString&);
+    static QString generatedName(const QString&);
+    static bool readSpecification(const QString&, QString&, QStringList&);
+
+private:
+    QMutex mutex;
+    QWaitCondition generatorFinished;
+    QString directory;
+    QHash<QByteArray, QString> generatedFiles;
+    QSet<QByteArray> runningKeys;
+    QHash<QString, QByteArray> generatorHashes;
+    QByteArray getKey(const QString&, const QStringList&);
+    static bool runGenerator(const QString&, const QStringList&, const QString&, const QString&);
+};
+
+#endif // DATAGENERATOR_H
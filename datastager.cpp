@@ -0,0 +1,271 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "datastager.h"
+#include "gziputil.h"
+#include "datagenerator.h"
+
+class DataStagerThread : public QThread
+{
+public:
+    DataStagerThread(DataStager*);
+
+protected:
+    void run();
+
+private:
+    DataStager *stager;
+};
+
+DataStagerThread::DataStagerThread(DataStager *_stager)
+{
+    stager = _stager;
+}
+
+void DataStagerThread::run()
+{
+    stager->processQueue();
+}
+
+DataStager::DataStager(QObject *parent) :
+    QObject(parent)
+{
+    thread = new DataStagerThread(this);
+    memoryLimit = 0;
+    usedBytes = 0;
+    useCounter = 0;
+    nameCounter = 0;
+    cancelled = false;
+}
+
+DataStager::~DataStager()
+{
+    clear();
+    delete thread;
+}
+
+QString DataStager::stagingPath()
+{
+    QString root = QDir::tempPath();
+#ifdef Q_OS_LINUX
+    QFileInfo sharedMemory("/dev/shm");
+    if (sharedMemory.isDir() && sharedMemory.isWritable()) root = sharedMemory.absoluteFilePath();
+#endif
+    return QDir(root).absoluteFilePath(QString("lemon-stage-%1").arg(QCoreApplication::applicationPid()));
+}
+
+QString DataStager::unpackingPath()
+{
+    return QDir(QDir::tempPath()).absoluteFilePath(QString("lemon-unpacked-%1").arg(QCoreApplication::applicationPid()));
+}
+
+void DataStager::setMemoryLimit(qint64 limit)
+{
+    QMutexLocker locker(&mutex);
+    memoryLimit = limit;
+}
+
+void DataStager::stageFiles(const QStringList &fileNames, bool pin)
+{
+    QMutexLocker locker(&mutex);
+    if (memoryLimit <= 0) return;
+    
+    if (directory.isEmpty()) {
+        directory = stagingPath();
+        if (! QDir().mkpath(directory)) {
+            directory.clear();
+            return;
+        }
+    }
+    
+    if (pin) {
+        QHash<QString, StagedFile>::iterator iter;
+        for (iter = files.begin(); iter != files.end(); ++ iter) {
+            iter->pinned = false;
+        }
+    }
+    
+    useCounter ++;
+    QStringList newFiles;
+    for (int i = 0; i < fileNames.size(); i ++) {
+        if (DataGenerator::isGenerated(fileNames[i])) continue;
+        QString source = QFileInfo(fileNames[i]).absoluteFilePath();
+        if (files.contains(source)) {
+            StagedFile &file = files[source];
+            file.lastUse = useCounter;
+            if (pin) {
+                file.pinned = true;
+                if (! file.done && queue.removeAll(source) > 0) newFiles.append(source);
+            }
+            continue;
+        }
+        StagedFile file;
+        file.size = 0;
+        file.lastUse = useCounter;
+        file.pinned = pin;
+        file.done = false;
+        files.insert(source, file);
+        newFiles.append(source);
+    }
+    
+    if (pin) {
+        queue = newFiles + queue;
+    } else {
+        queue += newFiles;
+    }
+    if (! queue.isEmpty()) {
+        queueCondition.wakeAll();
+        if (! thread->isRunning()) thread->start();
+    }
+}
+
+QString DataStager::acquire(const QString &fileName)
+{
+    QString source = QFileInfo(fileName).absoluteFilePath();
+    QMutexLocker locker(&mutex);
+    while (files.contains(source) && ! files[source].done && ! cancelled) {
+        stagedCondition.wait(&mutex);
+    }
+    if (files.contains(source) && ! files[source].path.isEmpty()) return files[source].path;
+    if (GzipUtil::isCompressed(source)) return unpack(source, locker);
+    return fileName;
+}
+
+QString DataStager::unpack(const QString &source, QMutexLocker &locker)
+{
+    while (unpackedFiles.contains(source) && ! unpackedFiles[source].done && ! cancelled) {
+        stagedCondition.wait(&mutex);
+    }
+    // An entry that is done without a path is a failed decompression
+    if (unpackedFiles.contains(source) && unpackedFiles[source].done) return unpackedFiles[source].path;
+    
+    if (unpackDirectory.isEmpty()) {
+        unpackDirectory = unpackingPath();
+        QDir().mkpath(unpackDirectory);
+    }
+    QString target = QDir(unpackDirectory).absoluteFilePath(QString("%1_%2").arg(nameCounter ++)
+                                                            .arg(GzipUtil::uncompressedName(QFileInfo(source).fileName())));
+    StagedFile file;
+    file.size = 0;
+    file.lastUse = 0;
+    file.pinned = false;
+    file.done = false;
+    unpackedFiles.insert(source, file);
+    locker.unlock();
+    
+    bool unpacked = GzipUtil::decompress(source, target);
+    
+    locker.relock();
+    StagedFile &entry = unpackedFiles[source];
+    entry.done = true;
+    if (unpacked) {
+        entry.path = target;
+    } else {
+        QFile::remove(target);
+    }
+    stagedCondition.wakeAll();
+    return entry.path;
+}
+
+void DataStager::clear()
+{
+    mutex.lock();
+    cancelled = true;
+    queueCondition.wakeAll();
+    stagedCondition.wakeAll();
+    mutex.unlock();
+    thread->wait();
+    
+    QMutexLocker locker(&mutex);
+    QHash<QString, StagedFile>::const_iterator iter;
+    for (iter = files.constBegin(); iter != files.constEnd(); ++ iter) {
+        if (! iter->path.isEmpty()) QFile::remove(iter->path);
+    }
+    for (iter = unpackedFiles.constBegin(); iter != unpackedFiles.constEnd(); ++ iter) {
+        if (! iter->path.isEmpty()) QFile::remove(iter->path);
+    }
+    if (! directory.isEmpty()) QDir().rmdir(directory);
+    if (! unpackDirectory.isEmpty()) QDir().rmdir(unpackDirectory);
+    directory.clear();
+    unpackDirectory.clear();
+    files.clear();
+    unpackedFiles.clear();
+    queue.clear();
+    usedBytes = 0;
+    cancelled = false;
+}
+
+bool DataStager::makeRoom(qint64 size, bool evict)
+{
+    if (size > memoryLimit) return false;
+    while (usedBytes + size > memoryLimit) {
+        if (! evict) return false;
+        QHash<QString, StagedFile>::iterator victim = files.end();
+        QHash<QString, StagedFile>::iterator iter;
+        for (iter = files.begin(); iter != files.end(); ++ iter) {
+            if (iter->pinned || iter->path.isEmpty()) continue;
+            if (victim == files.end() || iter->lastUse < victim->lastUse) victim = iter;
+        }
+        if (victim == files.end()) return false;
+        QFile::remove(victim->path);
+        usedBytes -= victim->size;
+        files.erase(victim);
+    }
+    return true;
+}
+
+void DataStager::processQueue()
+{
+    while (true) {
+        mutex.lock();
+        while (! cancelled && queue.isEmpty()) queueCondition.wait(&mutex);
+        if (cancelled) {
+            mutex.unlock();
+            return;
+        }
+        QString source = queue.takeFirst();
+        qint64 size;
+        if (GzipUtil::isCompressed(source)) {
+            size = GzipUtil::uncompressedSize(source);
+        } else {
+            size = QFileInfo(source).size();
+        }
+        bool reserved = size >= 0 && makeRoom(size, files[source].pinned);
+        QString target;
+        if (reserved) {
+            target = QDir(directory).absoluteFilePath(QString("%1_%2").arg(nameCounter ++)
+                                                      .arg(GzipUtil::uncompressedName(QFileInfo(source).fileName())));
+            usedBytes += size;
+        }
+        mutex.unlock();
+        
+        bool copied = reserved && GzipUtil::copyFile(source, target);
+        if (reserved && ! copied) QFile::remove(target);
+        
+        mutex.lock();
+        StagedFile &file = files[source];
+        file.done = true;
+        if (copied) {
+            file.path = target;
+            file.size = size;
+        } else if (reserved) {
+            usedBytes -= size;
+        }
+        stagedCondition.wakeAll();
+        mutex.unlock();
+    }
+}
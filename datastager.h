@@ -0,0 +1,68 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef DATASTAGER_H
+#define DATASTAGER_H
+
+#include <QtCore>
+#include <QObject>
+
+class DataStagerThread;
+
+class DataStager : public QObject
+{
+    Q_OBJECT
+    friend class DataStagerThread;
+public:
+    explicit DataStager(QObject *parent = 0);
+    ~DataStager();
+    void setMemoryLimit(qint64);
+    void stageFiles(const QStringList&, bool);
+    QString acquire(const QString&);
+    void clear();
+    static QString stagingPath();
+    static QString unpackingPath();
+
+private:
+    struct StagedFile {
+        QString path;
+        qint64 size;
+        int lastUse;
+        bool pinned;
+        bool done;
+    };
+    
+    DataStagerThread *thread;
+    QMutex mutex;
+    QWaitCondition queueCondition;
+    QWaitCondition stagedCondition;
+    QHash<QString, StagedFile> files;
+    QHash<QString, StagedFile> unpackedFiles;
+    QStringList queue;
+    QString directory;
+    QString unpackDirectory;
+    qint64 memoryLimit;
+    qint64 usedBytes;
+    int useCounter;
+    int nameCounter;
+    bool cancelled;
+    void processQueue();
+    bool makeRoom(qint64, bool);
+    QString unpack(const QString&, QMutexLocker&);
+};
+
+#endif // DATASTAGER_H
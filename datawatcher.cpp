@@ -0,0 +1,158 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "datawatcher.h"
+
+static const int debounceInterval = 300;
+
+DataWatcher::DataWatcher(QObject *parent) :
+    QObject(parent)
+{
+    watcher = 0;
+    debounceTimer = new QTimer(this);
+    debounceTimer->setSingleShot(true);
+    debounceTimer->setInterval(debounceInterval);
+    connect(debounceTimer, SIGNAL(timeout()),
+            this, SLOT(processChanges()));
+}
+
+void DataWatcher::setRootPath(const QString &path)
+{
+    stop();
+    rootPath = QDir(path).absolutePath();
+    watcher = new QFileSystemWatcher(this);
+    connect(watcher, SIGNAL(directoryChanged(QString)),
+            this, SLOT(directoryChanged(QString)));
+    QStringList changed;
+    addDirectory(rootPath, changed);
+}
+
+void DataWatcher::stop()
+{
+    debounceTimer->stop();
+    if (watcher) delete watcher;
+    watcher = 0;
+    listings.clear();
+    pendingDirs.clear();
+}
+
+void DataWatcher::addDirectory(const QString &path, QStringList &changed)
+{
+    if (listings.contains(path)) return;
+    listings.insert(path, QHash<QString, FileStamp>());
+    watcher->addPath(path);
+    scanDirectory(path, changed);
+}
+
+void DataWatcher::removeDirectory(const QString &path, QStringList &changed)
+{
+    if (! listings.contains(path)) return;
+    QHash<QString, FileStamp> listing = listings.take(path);
+    watcher->removePath(path);
+    pendingDirs.remove(path);
+    
+    QHash<QString, FileStamp>::const_iterator iter;
+    for (iter = listing.constBegin(); iter != listing.constEnd(); ++ iter) {
+        changed.append(path + "/" + iter.key());
+    }
+    
+    QString prefix = path + "/";
+    QStringList subDirs;
+    QHash<QString, QHash<QString, FileStamp> >::const_iterator dirIter;
+    for (dirIter = listings.constBegin(); dirIter != listings.constEnd(); ++ dirIter) {
+        if (dirIter.key().startsWith(prefix)) subDirs.append(dirIter.key());
+    }
+    for (int i = 0; i < subDirs.size(); i ++) {
+        removeDirectory(subDirs[i], changed);
+    }
+}
+
+void DataWatcher::scanDirectory(const QString &path, QStringList &changed)
+{
+    QDir dir(path);
+    QHash<QString, FileStamp> &listing = listings[path];
+    QHash<QString, FileStamp> current;
+    
+    QFileInfoList list = dir.entryInfoList(QDir::Files | QDir::Hidden);
+    for (int i = 0; i < list.size(); i ++) {
+        FileStamp stamp;
+        stamp.size = list[i].size();
+        stamp.lastModified = list[i].lastModified();
+        current.insert(list[i].fileName(), stamp);
+        
+        if (! listing.contains(list[i].fileName())) {
+            changed.append(list[i].absoluteFilePath());
+        } else {
+            const FileStamp &old = listing[list[i].fileName()];
+            if (old.size != stamp.size || old.lastModified != stamp.lastModified) {
+                changed.append(list[i].absoluteFilePath());
+            }
+        }
+    }
+    
+    QHash<QString, FileStamp>::const_iterator iter;
+    for (iter = listing.constBegin(); iter != listing.constEnd(); ++ iter) {
+        if (! current.contains(iter.key())) changed.append(path + "/" + iter.key());
+    }
+    listing = current;
+    
+    QStringList subDirs = dir.entryList(QDir::AllDirs | QDir::NoDotAndDotDot);
+    for (int i = 0; i < subDirs.size(); i ++) {
+        addDirectory(path + "/" + subDirs[i], changed);
+    }
+}
+
+void DataWatcher::directoryChanged(const QString &path)
+{
+    pendingDirs.insert(QDir(path).absolutePath());
+    debounceTimer->start();
+}
+
+void DataWatcher::processChanges()
+{
+    if (! watcher) return;
+    
+    QStringList changed;
+    QStringList dirs = pendingDirs.toList();
+    pendingDirs.clear();
+    qSort(dirs);
+    
+    for (int i = 0; i < dirs.size(); i ++) {
+        if (! listings.contains(dirs[i])) continue;
+        if (! QDir(dirs[i]).exists()) {
+            removeDirectory(dirs[i], changed);
+            continue;
+        }
+        QString prefix = dirs[i] + "/";
+        QStringList known;
+        QHash<QString, QHash<QString, FileStamp> >::const_iterator iter;
+        for (iter = listings.constBegin(); iter != listings.constEnd(); ++ iter) {
+            if (iter.key().startsWith(prefix) && ! iter.key().mid(prefix.length()).contains('/')) {
+                known.append(iter.key());
+            }
+        }
+        for (int j = 0; j < known.size(); j ++) {
+            if (! QDir(known[j]).exists()) removeDirectory(known[j], changed);
+        }
+        scanDirectory(dirs[i], changed);
+    }
+    
+    if (! changed.isEmpty()) {
+        changed.removeDuplicates();
+        emit filesChanged(changed);
+    }
+}
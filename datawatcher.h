@@ -0,0 +1,55 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef DATAWATCHER_H
+#define DATAWATCHER_H
+
+#include <QtCore>
+#include <QObject>
+
+class DataWatcher : public QObject
+{
+    Q_OBJECT
+public:
+    explicit DataWatcher(QObject *parent = 0);
+    void setRootPath(const QString&);
+    void stop();
+
+private:
+    struct FileStamp {
+        qint64 size;
+        QDateTime lastModified;
+    };
+    
+    QFileSystemWatcher *watcher;
+    QTimer *debounceTimer;
+    QString rootPath;
+    QHash<QString, QHash<QString, FileStamp> > listings;
+    QSet<QString> pendingDirs;
+    void addDirectory(const QString&, QStringList&);
+    void removeDirectory(const QString&, QStringList&);
+    void scanDirectory(const QString&, QStringList&);
+
+private slots:
+    void directoryChanged(const QString&);
+    void processChanges();
+
+signals:
+    void filesChanged(const QStringList&);
+};
+
+#endif // DATAWATCHER_H
@@ -21,6 +21,80 @@
 #include "task.h"
 #include "testcase.h"
 #include "contestant.h"
+#include "resulttable.h"
+#include "xlsxwriter.h"
+
+#define ColumnarMagicNumber 0x20130424
+
+static const int htmlRenderWindow = 64;
+static const int streamBufferSize = 1 << 16;
+static const int columnarColumnCount = 9;
+
+struct HtmlRenderQueue
+{
+    Contest *contest;
+    QList<Contestant*> order;
+    QList<int> anchors;
+    QList<bool> wasLoaded;
+    QVector<QByteArray> sections;
+    QVector<bool> finished;
+    int next;
+    int written;
+    bool cancelled;
+    QMutex mutex;
+    QWaitCondition sectionReady;
+    QWaitCondition windowFree;
+};
+
+class HtmlRenderThread : public QThread
+{
+public:
+    HtmlRenderThread(HtmlRenderQueue*, QObject *parent = 0);
+
+protected:
+    void run();
+
+private:
+    HtmlRenderQueue *queue;
+};
+
+HtmlRenderThread::HtmlRenderThread(HtmlRenderQueue *_queue, QObject *parent) :
+    QThread(parent)
+{
+    queue = _queue;
+}
+
+void HtmlRenderThread::run()
+{
+    while (true) {
+        queue->mutex.lock();
+        while (! queue->cancelled && queue->next < queue->order.size()
+               && queue->next >= queue->written + htmlRenderWindow) {
+            queue->windowFree.wait(&queue->mutex);
+        }
+        if (queue->cancelled || queue->next >= queue->order.size()) {
+            queue->mutex.unlock();
+            return;
+        }
+        int index = queue->next ++;
+        queue->mutex.unlock();
+        
+        Contestant *contestant = queue->order[index];
+        contestant->ensureLoaded();
+        QString htmlCode;
+        htmlCode += QString("<a name=\"c%1\"><hr><a>").arg(queue->anchors[index]);
+        htmlCode += "<span style=\"font-size:x-large; font-weight:bold;\">";
+        htmlCode += ExportUtil::tr("Contestant: %1").arg(contestant->getContestantName()) + "</span>";
+        htmlCode += ExportUtil::getContestantHtmlCode(queue->contest, contestant);
+        QByteArray data = htmlCode.toUtf8();
+        
+        queue->mutex.lock();
+        queue->sections[index] = data;
+        queue->finished[index] = true;
+        queue->sectionReady.wakeAll();
+        queue->mutex.unlock();
+    }
+}
 
 ExportUtil::ExportUtil(QObject *parent) :
     QObject(parent)
@@ -87,63 +161,22 @@ QString ExportUtil::getContestantHtmlCode(Contest *contest, Contestant *contesta
         htmlCode += QString("<th scope=\"col\" nowrap=\"nowrap\">%1</th>").arg(tr("Memory Used"));
         htmlCode += QString("<th scope=\"col\" nowrap=\"nowrap\">%1</th></tr>").arg(tr("Score"));
         
-        QList<QStringList> inputFiles = contestant->getInputFiles(i);
-        QList< QList<ResultState> > result = contestant->getResult(i);
-        QList<QStringList> message = contestant->getMessage(i);
-        QList< QList<int> > timeUsed = contestant->getTimeUsed(i);
-        QList< QList<int> > memoryUsed = contestant->getMemoryUsed(i);
-        QList< QList<int> > score = contestant->getSocre(i);
+        const ResultTable &table = contestant->getResultTable(i);
         
-        for (int j = 0; j < inputFiles.size(); j ++) {
-            for (int k = 0; k < inputFiles[j].size(); k ++) {
+        for (int j = 0; j < table.getTestCaseCount(); j ++) {
+            for (int k = 0; k < table.getSingleCaseCount(j); k ++) {
+                int offset = table.getOffset(j, k);
                 htmlCode += "<tr>";
                 if (k == 0) {
                     htmlCode += QString("<td nowrap=\"nowrap\" rowspan=\"%1\" align=\"center\" valign=\"middle\">#%2</td>")
-                                .arg(inputFiles[j].size()).arg(j + 1);
+                                .arg(table.getSingleCaseCount(j)).arg(j + 1);
                 }
                 
-                htmlCode += QString("<td nowrap=\"nowrap\" align=\"center\">%1</td>").arg(inputFiles[j][k]);
-                
-                QString text;
-                switch (result[j][k]) {
-                    case CorrectAnswer:
-                        text = tr("Correct Answer");
-                        break;
-                    case WrongAnswer:
-                        text = tr("Wrong Answer");
-                        break;
-                    case PartlyCorrect:
-                        text = tr("Partly Correct");
-                        break;
-                    case TimeLimitExceeded:
-                        text = tr("Time Limit Exceeded");
-                        break;
-                    case MemoryLimitExceeded:
-                        text = tr("Memory Limit Exceeded");
-                        break;
-                    case CannotStartProgram:
-                        text = tr("Cannot Start Program");
-                        break;
-                    case FileError:
-                        text = tr("File Error");
-                        break;
-                    case RunTimeError:
-                        text = tr("Run Time Error");
-                        break;
-                    case InvalidSpecialJudge:
-                        text = tr("Invalid Special Judge");
-                        break;
-                    case SpecialJudgeTimeLimitExceeded:
-                        text = tr("Special Judge Time Limit Exceeded");
-                        break;
-                    case SpecialJudgeRunTimeError:
-                        text = tr("Special Judge Run Time Error");
-                        break;
-                }
+                htmlCode += QString("<td nowrap=\"nowrap\" align=\"center\">%1</td>").arg(table.inputFileAt(offset));
                 
-                htmlCode += QString("<td align=\"center\">%1").arg(text);
-                if (! message[j][k].isEmpty()) {
-                    QString tmp = message[j][k];
+                htmlCode += QString("<td align=\"center\">%1").arg(getResultText(table.resultAt(offset)));
+                if (! table.messageAt(offset).isEmpty()) {
+                    QString tmp = table.messageAt(offset);
                     tmp.replace("\n", "\\n");
                     tmp.replace("\"", "\\");
                     htmlCode += QString("<a href=\"javascript:alert(&quot;%1&quot;)\"> (...)")
@@ -152,27 +185,24 @@ QString ExportUtil::getContestantHtmlCode(Contest *contest, Contestant *contesta
                 htmlCode += "</td>";
                 
                 htmlCode += "<td nowrap=\"nowrap\" align=\"center\">";
-                if (timeUsed[j][k] != -1) {
-                    htmlCode += QString("").sprintf("%.3lf s", double(timeUsed[j][k]) / 1000);
+                if (table.timeUsedAt(offset) != -1) {
+                    htmlCode += QString("").sprintf("%.3lf s", double(table.timeUsedAt(offset)) / 1000);
                 } else {
                     htmlCode += tr("Invalid");
                 }
                 htmlCode += "</td>";
                 
                 htmlCode += "<td nowrap=\"nowrap\" align=\"center\">";
-                if (memoryUsed[j][k] != -1) {
-                    htmlCode += QString("").sprintf("%.3lf MB", double(memoryUsed[j][k]) / 1024 / 1024);
+                if (table.memoryUsedAt(offset) != -1) {
+                    htmlCode += QString("").sprintf("%.3lf MB", double(table.memoryUsedAt(offset)) / 1024 / 1024);
                 } else {
                     htmlCode += tr("Invalid");
                 }
                 htmlCode += "</td>";
                 
                 if (k == 0) {
-                    htmlCode += QString("<td rowspan=\"%1\" align=\"center\" valign=\"middle\">").arg(inputFiles[j].size());
-                    int minv = 1000000000;
-                    for (int t = 0; t < inputFiles[j].size(); t ++)
-                        if (score[j][t] < minv) minv = score[j][t];
-                    htmlCode += QString("%1</td>").arg(minv);
+                    htmlCode += QString("<td rowspan=\"%1\" align=\"center\" valign=\"middle\">").arg(table.getSingleCaseCount(j));
+                    htmlCode += QString("%1</td>").arg(table.getTestCaseScore(j));
                 }
                 
                 htmlCode += "</tr>";
@@ -186,16 +216,40 @@ QString ExportUtil::getContestantHtmlCode(Contest *contest, Contestant *contesta
     return htmlCode;
 }
 
-void ExportUtil::exportHtml(QWidget *widget, Contest *contest, const QString &fileName)
+QString ExportUtil::getResultText(ResultState result)
 {
-    QFile file(fileName);
-    if (! file.open(QFile::WriteOnly)) {
-        QMessageBox::warning(widget, tr("Lemon"), tr("Cannot open file %1").arg(QFileInfo(file).fileName()),
-                             QMessageBox::Ok);
-        return;
+    switch (result) {
+        case CorrectAnswer:
+            return tr("Correct Answer");
+        case WrongAnswer:
+            return tr("Wrong Answer");
+        case PartlyCorrect:
+            return tr("Partly Correct");
+        case TimeLimitExceeded:
+            return tr("Time Limit Exceeded");
+        case MemoryLimitExceeded:
+            return tr("Memory Limit Exceeded");
+        case CannotStartProgram:
+            return tr("Cannot Start Program");
+        case FileError:
+            return tr("File Error");
+        case RunTimeError:
+            return tr("Run Time Error");
+        case InvalidSpecialJudge:
+            return tr("Invalid Special Judge");
+        case SpecialJudgeTimeLimitExceeded:
+            return tr("Special Judge Time Limit Exceeded");
+        case SpecialJudgeRunTimeError:
+            return tr("Special Judge Run Time Error");
     }
+    return QString();
+}
+
+bool ExportUtil::writeHtml(Contest *contest, const QString &fileName, QProgressDialog *progress)
+{
+    QFile file(fileName);
+    if (! file.open(QFile::WriteOnly)) return false;
     
-    QApplication::setOverrideCursor(Qt::WaitCursor);
     QTextStream out(&file);
     
     QList<Contestant*> contestantList = contest->getContestantList();
@@ -208,26 +262,8 @@ void ExportUtil::exportHtml(QWidget *widget, Contest *contest, const QString &fi
     out << "<title>" << tr("Contest Result") << "</title>";
     out << "</head><body>";
     
-    QList< QPair<int, QString> > sortList;
-    for (int i = 0; i < contestantList.size(); i ++) {
-        int totalScore = contestantList[i]->getTotalScore();
-        if (totalScore != -1) {
-            sortList.append(qMakePair(-totalScore, contestantList[i]->getContestantName()));
-        } else {
-            sortList.append(qMakePair(1, contestantList[i]->getContestantName()));
-        }
-    }
-    qSort(sortList);
-    QMap<QString, int> rankList;
-    for (int i = 0; i < sortList.size(); i ++) {
-        if (i > 0 && sortList[i].first == sortList[i-1].first) {
-            rankList.insert(sortList[i].second, rankList[sortList[i-1].second]);
-        } else {
-            rankList.insert(sortList[i].second, i);
-        }
-    }
-    
-    QMap<Contestant*, int> loc;
+    const RankList &rankList = contest->getRankList();
+    QHash<Contestant*, int> loc;
     for (int i = 0; i < contestantList.size(); i ++) {
         loc.insert(contestantList[i], i);
     }
@@ -241,12 +277,12 @@ void ExportUtil::exportHtml(QWidget *widget, Contest *contest, const QString &fi
         out << QString("<th scope=\"col\" nowrap=\"nowrap\">%1</th>").arg(taskList[i]->getProblemTile());
     out << QString("<th scope=\"col\" nowrap=\"nowrap\">%1</th></tr>").arg(tr("Total Score"));
     
-    for (int i = 0; i < sortList.size(); i ++) {
-        Contestant *contestant = contest->getContestant(sortList[i].second);
+    for (int i = 0; i < rankList.size(); i ++) {
+        Contestant *contestant = rankList.contestantAt(i);
         out << QString("<tr><td nowrap=\"nowrap\" align=\"center\">%1</td>")
-               .arg(rankList[contestant->getContestantName()] + 1);
+               .arg(rankList.rankAt(i));
         out << QString("<td nowrap=\"nowrap\" align=\"center\"><a href=\"#c%1\">%2</a></td>")
-               .arg(loc[contestant]).arg(sortList[i].second);
+               .arg(loc[contestant]).arg(contestant->getContestantName());
         for (int j = 0; j < taskList.size(); j ++) {
             int score = contestant->getTaskScore(j);
             if (score != -1) {
@@ -263,55 +299,99 @@ void ExportUtil::exportHtml(QWidget *widget, Contest *contest, const QString &fi
         }
     }
     out << "</table></p>";
+    out.flush();
     
-    for (int i = 0; i < contestantList.size(); i ++) {
-        out << QString("<a name=\"c%1\"><hr><a>").arg(i) << "<span style=\"font-size:x-large; font-weight:bold;\">";
-        out << tr("Contestant: %1").arg(contestantList[i]->getContestantName()) << "</span>";
-        out << getContestantHtmlCode(contest, contestantList[i]);
+    HtmlRenderQueue queue;
+    queue.contest = contest;
+    for (int i = 0; i < rankList.size(); i ++) {
+        Contestant *contestant = rankList.contestantAt(i);
+        queue.order.append(contestant);
+        queue.anchors.append(loc[contestant]);
+        queue.wasLoaded.append(contestant->isLoaded());
     }
-    out << "</body></html>";
+    queue.sections.resize(queue.order.size());
+    queue.finished.fill(false, queue.order.size());
+    queue.next = 0;
+    queue.written = 0;
+    queue.cancelled = false;
     
-    QApplication::restoreOverrideCursor();
-    QMessageBox::information(widget, tr("Lemon"), tr("Export is done"), QMessageBox::Ok);
-}
-
-void ExportUtil::exportCsv(QWidget *widget, Contest *contest, const QString &fileName)
-{
-    QFile file(fileName);
-    if (! file.open(QFile::WriteOnly)) {
-        QMessageBox::warning(widget, tr("Lemon"), tr("Cannot open file %1").arg(QFileInfo(file).fileName()),
-                             QMessageBox::Ok);
-        return;
+#ifndef LEMON_NO_GUI
+    if (progress) {
+        progress->setMaximum(queue.order.size());
+        progress->setValue(0);
     }
+#endif
     
-    QApplication::setOverrideCursor(Qt::WaitCursor);
-    QTextStream out(&file);
+    QList<HtmlRenderThread*> threads;
+    int threadCount = qMax(1, QThread::idealThreadCount());
+    for (int i = 0; i < threadCount; i ++) {
+        threads.append(new HtmlRenderThread(&queue));
+        threads[i]->start();
+    }
     
-    QList<Contestant*> contestantList = contest->getContestantList();
-    QList<Task*> taskList = contest->getTaskList();
-    QList< QPair<int, QString> > sortList;
-    for (int i = 0; i < contestantList.size(); i ++) {
-        int totalScore = contestantList[i]->getTotalScore();
-        if (totalScore != -1) {
-            sortList.append(qMakePair(-totalScore, contestantList[i]->getContestantName()));
-        } else {
-            sortList.append(qMakePair(1, contestantList[i]->getContestantName()));
+    bool cancelled = false;
+    for (int i = 0; i < queue.order.size() && ! cancelled; i ++) {
+        queue.mutex.lock();
+        while (! queue.finished[i]) {
+            queue.sectionReady.wait(&queue.mutex, 100);
+#ifndef LEMON_NO_GUI
+            if (progress) {
+                queue.mutex.unlock();
+                QCoreApplication::processEvents();
+                cancelled = progress->wasCanceled();
+                queue.mutex.lock();
+                if (cancelled) break;
+            }
+#endif
         }
-    }
-    qSort(sortList);
-    QMap<QString, int> rankList;
-    for (int i = 0; i < sortList.size(); i ++) {
-        if (i > 0 && sortList[i].first == sortList[i-1].first) {
-            rankList.insert(sortList[i].second, rankList[sortList[i-1].second]);
-        } else {
-            rankList.insert(sortList[i].second, i);
+        if (cancelled) {
+            queue.mutex.unlock();
+            break;
         }
+        QByteArray data = queue.sections[i];
+        queue.sections[i].clear();
+        queue.written = i + 1;
+        queue.windowFree.wakeAll();
+        queue.mutex.unlock();
+        
+        // Sections are rendered from loaded details; release them once written
+        if (! queue.wasLoaded[i]) queue.order[i]->unload();
+        if (file.write(data) != data.size()) cancelled = true;
+#ifndef LEMON_NO_GUI
+        if (progress) progress->setValue(i + 1);
+#endif
     }
     
-    QMap<Contestant*, int> loc;
-    for (int i = 0; i < contestantList.size(); i ++) {
-        loc.insert(contestantList[i], i);
+    queue.mutex.lock();
+    queue.cancelled = true;
+    queue.windowFree.wakeAll();
+    queue.mutex.unlock();
+    for (int i = 0; i < threads.size(); i ++) {
+        threads[i]->wait();
+        delete threads[i];
+    }
+    for (int i = queue.written; i < queue.order.size(); i ++) {
+        if (! queue.wasLoaded[i]) queue.order[i]->unload();
+    }
+    
+    if (cancelled) {
+        file.close();
+        file.remove();
+        return false;
     }
+    out << "</body></html>";
+    return true;
+}
+
+bool ExportUtil::writeCsv(Contest *contest, const QString &fileName)
+{
+    QFile file(fileName);
+    if (! file.open(QFile::WriteOnly)) return false;
+    
+    QTextStream out(&file);
+    
+    QList<Task*> taskList = contest->getTaskList();
+    const RankList &rankList = contest->getRankList();
     
     out << "\"" << tr("Rank") << "\"" << "," << "\"" << tr("Name") << "\"" << ",";
     for (int i = 0; i < taskList.size(); i ++) {
@@ -319,10 +399,10 @@ void ExportUtil::exportCsv(QWidget *widget, Contest *contest, const QString &fil
     }
     out << "\"" << tr("Total Score") << "\"" << endl;
     
-    for (int i = 0; i < sortList.size(); i ++) {
-        Contestant *contestant = contest->getContestant(sortList[i].second);
-        out << "\"" << rankList[contestant->getContestantName()] + 1 << "\"" << ",";
-        out << "\"" << sortList[i].second << "\"" << ",";
+    for (int i = 0; i < rankList.size(); i ++) {
+        Contestant *contestant = rankList.contestantAt(i);
+        out << "\"" << rankList.rankAt(i) << "\"" << ",";
+        out << "\"" << contestant->getContestantName() << "\"" << ",";
         for (int j = 0; j < taskList.size(); j ++) {
             int score = contestant->getTaskScore(j);
             if (score != -1) {
@@ -339,7 +419,412 @@ void ExportUtil::exportCsv(QWidget *widget, Contest *contest, const QString &fil
         }
     }
     
+    return true;
+}
+
+// One sheet per task lists every case; contestants loaded for a sheet are
+// released right after their rows, so only one contestant's details are in
+// memory at a time, at the cost of reading each chunk once per task.
+bool ExportUtil::writeXlsx(Contest *contest, const QString &fileName)
+{
+    XlsxWriter writer;
+    if (! writer.open(fileName)) return false;
+    
+    QList<Task*> taskList = contest->getTaskList();
+    const RankList &rankList = contest->getRankList();
+    
+    writer.beginSheet(QDate::currentDate().toString("yyyy-MM-dd"));
+    QVariantList header;
+    header << tr("Rank") << tr("Name");
+    for (int i = 0; i < taskList.size(); i ++) {
+        header << taskList[i]->getProblemTile();
+    }
+    header << tr("Total Score");
+    writer.writeRow(header);
+    
+    for (int i = 0; i < rankList.size(); i ++) {
+        Contestant *contestant = rankList.contestantAt(i);
+        QVariantList row;
+        row << rankList.rankAt(i) << contestant->getContestantName();
+        for (int j = 0; j < taskList.size(); j ++) {
+            int score = contestant->getTaskScore(j);
+            if (score != -1) {
+                row << score;
+            } else {
+                row << tr("Invalid");
+            }
+        }
+        int score = contestant->getTotalScore();
+        if (score != -1) {
+            row << score;
+        } else {
+            row << tr("Invalid");
+        }
+        writer.writeRow(row);
+    }
+    writer.endSheet();
+    
+    for (int i = 0; i < taskList.size(); i ++) {
+        writer.beginSheet(taskList[i]->getProblemTile());
+        QVariantList caseHeader;
+        caseHeader << tr("Name") << tr("Test Case") << tr("Input File") << tr("Result")
+                   << tr("Time Used (s)") << tr("Memory Used (MB)") << tr("Score");
+        writer.writeRow(caseHeader);
+        
+        for (int j = 0; j < rankList.size(); j ++) {
+            Contestant *contestant = rankList.contestantAt(j);
+            if (! contestant->getCheckJudged(i)) continue;
+            bool wasLoaded = contestant->isLoaded();
+            if (taskList[i]->getTaskType() == Task::Traditional
+                && contestant->getCompileState(i) != CompileSuccessfully) {
+                if (! wasLoaded) contestant->unload();
+                continue;
+            }
+            
+            const ResultTable &table = contestant->getResultTable(i);
+            for (int k = 0; k < table.getTestCaseCount(); k ++) {
+                for (int t = 0; t < table.getSingleCaseCount(k); t ++) {
+                    int offset = table.getOffset(k, t);
+                    QVariantList row;
+                    row << contestant->getContestantName() << k + 1 << table.inputFileAt(offset)
+                        << getResultText(table.resultAt(offset));
+                    if (table.timeUsedAt(offset) != -1) {
+                        row << double(table.timeUsedAt(offset)) / 1000;
+                    } else {
+                        row << tr("Invalid");
+                    }
+                    if (table.memoryUsedAt(offset) != -1) {
+                        row << double(table.memoryUsedAt(offset)) / 1024 / 1024;
+                    } else {
+                        row << tr("Invalid");
+                    }
+                    row << table.scoreAt(offset);
+                    writer.writeRow(row);
+                }
+            }
+            if (! wasLoaded) contestant->unload();
+        }
+        writer.endSheet();
+    }
+    
+    return writer.close();
+}
+
+const char* ExportUtil::getResultName(ResultState result)
+{
+    switch (result) {
+        case CorrectAnswer:
+            return "CorrectAnswer";
+        case WrongAnswer:
+            return "WrongAnswer";
+        case PartlyCorrect:
+            return "PartlyCorrect";
+        case TimeLimitExceeded:
+            return "TimeLimitExceeded";
+        case MemoryLimitExceeded:
+            return "MemoryLimitExceeded";
+        case CannotStartProgram:
+            return "CannotStartProgram";
+        case FileError:
+            return "FileError";
+        case RunTimeError:
+            return "RunTimeError";
+        case InvalidSpecialJudge:
+            return "InvalidSpecialJudge";
+        case SpecialJudgeTimeLimitExceeded:
+            return "SpecialJudgeTimeLimitExceeded";
+        case SpecialJudgeRunTimeError:
+            return "SpecialJudgeRunTimeError";
+    }
+    return "";
+}
+
+void ExportUtil::appendJsonString(QByteArray &out, const QString &str)
+{
+    QByteArray data = str.toUtf8();
+    out += '"';
+    for (int i = 0; i < data.size(); i ++) {
+        char ch = data[i];
+        if (ch == '"') {
+            out += "\\\"";
+        } else if (ch == '\\') {
+            out += "\\\\";
+        } else if (ch == '\n') {
+            out += "\\n";
+        } else if (ch == '\r') {
+            out += "\\r";
+        } else if (ch == '\t') {
+            out += "\\t";
+        } else if (quint8(ch) < 0x20) {
+            out += "\\u00";
+            out += QByteArray::number(quint8(ch) >> 4, 16);
+            out += QByteArray::number(quint8(ch) & 15, 16);
+        } else {
+            out += ch;
+        }
+    }
+    out += '"';
+}
+
+// Contestants that were not loaded before are released after their lines
+// are written, so the export does not keep every result table in memory.
+bool ExportUtil::writeJsonLines(Contest *contest, const QString &fileName)
+{
+    QFile file(fileName);
+    if (! file.open(QFile::WriteOnly)) return false;
+    
+    QList<Task*> taskList = contest->getTaskList();
+    const RankList &rankList = contest->getRankList();
+    QHash<QString, int> messageId;
+    QByteArray buffer;
+    buffer.reserve(streamBufferSize + 4096);
+    
+    for (int i = 0; i < taskList.size(); i ++) {
+        buffer += "{\"type\":\"task\",\"task\":";
+        buffer += QByteArray::number(i);
+        buffer += ",\"title\":";
+        appendJsonString(buffer, taskList[i]->getProblemTile());
+        buffer += "}\n";
+    }
+    
+    for (int i = 0; i < rankList.size(); i ++) {
+        Contestant *contestant = rankList.contestantAt(i);
+        bool wasLoaded = contestant->isLoaded();
+        QByteArray name;
+        appendJsonString(name, contestant->getContestantName());
+        
+        for (int j = 0; j < taskList.size(); j ++) {
+            if (! contestant->getCheckJudged(j)) continue;
+            const ResultTable &table = contestant->getResultTable(j);
+            for (int k = 0; k < table.getTestCaseCount(); k ++) {
+                for (int t = 0; t < table.getSingleCaseCount(k); t ++) {
+                    int offset = table.getOffset(k, t);
+                    int id = -1;
+                    QString message = table.messageAt(offset);
+                    if (! message.isEmpty()) {
+                        id = messageId.value(message, -1);
+                        if (id == -1) {
+                            id = messageId.size();
+                            messageId.insert(message, id);
+                            buffer += "{\"type\":\"message\",\"message\":";
+                            buffer += QByteArray::number(id);
+                            buffer += ",\"text\":";
+                            appendJsonString(buffer, message);
+                            buffer += "}\n";
+                        }
+                    }
+                    
+                    buffer += "{\"type\":\"case\",\"contestant\":";
+                    buffer += name;
+                    buffer += ",\"task\":";
+                    buffer += QByteArray::number(j);
+                    buffer += ",\"testCase\":";
+                    buffer += QByteArray::number(k + 1);
+                    buffer += ",\"singleCase\":";
+                    buffer += QByteArray::number(t + 1);
+                    buffer += ",\"result\":\"";
+                    buffer += getResultName(table.resultAt(offset));
+                    buffer += "\",\"score\":";
+                    buffer += QByteArray::number(table.scoreAt(offset));
+                    buffer += ",\"timeUsed\":";
+                    buffer += QByteArray::number(table.timeUsedAt(offset));
+                    buffer += ",\"memoryUsed\":";
+                    buffer += QByteArray::number(table.memoryUsedAt(offset));
+                    buffer += ",\"message\":";
+                    if (id != -1) {
+                        buffer += QByteArray::number(id);
+                    } else {
+                        buffer += "null";
+                    }
+                    buffer += "}\n";
+                    
+                    if (buffer.size() >= streamBufferSize) {
+                        if (file.write(buffer) != buffer.size()) return false;
+                        buffer.clear();
+                    }
+                }
+            }
+        }
+        if (! wasLoaded) contestant->unload();
+    }
+    
+    return file.write(buffer) == buffer.size() && file.flush();
+}
+
+// The case columns are collected in a single pass over the contestants,
+// one temporary file per column, because the string tables (including the
+// messages found on the way) have to precede them in the output.
+bool ExportUtil::writeColumnar(Contest *contest, const QString &fileName)
+{
+    QFile file(fileName);
+    if (! file.open(QFile::WriteOnly)) return false;
+    
+    QList<Task*> taskList = contest->getTaskList();
+    const RankList &rankList = contest->getRankList();
+    QHash<QString, int> messageId;
+    QStringList messages;
+    quint32 rowCount = 0;
+    bool succeeded = true;
+    
+    QList<QTemporaryFile*> columnFiles;
+    QList<QDataStream*> columns;
+    for (int i = 0; i < columnarColumnCount; i ++) {
+        columnFiles.append(new QTemporaryFile);
+        if (! columnFiles[i]->open()) succeeded = false;
+        columns.append(new QDataStream(columnFiles[i]));
+        columns[i]->setByteOrder(QDataStream::LittleEndian);
+    }
+    
+    for (int i = 0; succeeded && i < rankList.size(); i ++) {
+        Contestant *contestant = rankList.contestantAt(i);
+        bool wasLoaded = contestant->isLoaded();
+        for (int j = 0; j < taskList.size(); j ++) {
+            if (! contestant->getCheckJudged(j)) continue;
+            const ResultTable &table = contestant->getResultTable(j);
+            for (int k = 0; k < table.getTestCaseCount(); k ++) {
+                for (int t = 0; t < table.getSingleCaseCount(k); t ++) {
+                    int offset = table.getOffset(k, t);
+                    int id = -1;
+                    QString message = table.messageAt(offset);
+                    if (! message.isEmpty()) {
+                        id = messageId.value(message, -1);
+                        if (id == -1) {
+                            id = messages.size();
+                            messageId.insert(message, id);
+                            messages.append(message);
+                        }
+                    }
+                    *columns[0] << quint32(i);
+                    *columns[1] << quint32(j);
+                    *columns[2] << quint32(k + 1);
+                    *columns[3] << quint32(t + 1);
+                    *columns[4] << quint8(table.resultAt(offset));
+                    *columns[5] << qint32(table.scoreAt(offset));
+                    *columns[6] << qint32(table.timeUsedAt(offset));
+                    *columns[7] << qint64(table.memoryUsedAt(offset));
+                    *columns[8] << qint32(id);
+                }
+            }
+            rowCount += table.getCaseCount();
+        }
+        if (! wasLoaded) contestant->unload();
+    }
+    
+    QDataStream out(&file);
+    out.setByteOrder(QDataStream::LittleEndian);
+    out << quint32(ColumnarMagicNumber) << quint32(1) << rowCount;
+    
+    QList<QStringList> stringTables;
+    QStringList names;
+    for (int i = 0; i < rankList.size(); i ++) {
+        names.append(rankList.contestantAt(i)->getContestantName());
+    }
+    QStringList titles;
+    for (int i = 0; i < taskList.size(); i ++) {
+        titles.append(taskList[i]->getProblemTile());
+    }
+    stringTables << names << titles << messages;
+    for (int i = 0; i < stringTables.size(); i ++) {
+        out << quint32(stringTables[i].size());
+        for (int j = 0; j < stringTables[i].size(); j ++) {
+            QByteArray data = stringTables[i][j].toUtf8();
+            out << quint32(data.size());
+            out.writeRawData(data.constData(), data.size());
+        }
+    }
+    
+    for (int i = 0; succeeded && i < columnarColumnCount; i ++) {
+        if (columns[i]->status() != QDataStream::Ok || ! columnFiles[i]->flush() || ! columnFiles[i]->seek(0)) {
+            succeeded = false;
+            break;
+        }
+        while (! columnFiles[i]->atEnd()) {
+            QByteArray data = columnFiles[i]->read(streamBufferSize);
+            if (data.isEmpty() || file.write(data) != data.size()) {
+                succeeded = false;
+                break;
+            }
+        }
+    }
+    qDeleteAll(columns);
+    qDeleteAll(columnFiles);
+    
+    if (out.status() != QDataStream::Ok || ! file.flush() || file.error() != QFile::NoError) succeeded = false;
+    if (! succeeded) {
+        file.close();
+        file.remove();
+    }
+    return succeeded;
+}
+
+bool ExportUtil::exportToFile(Contest *contest, const QString &fileName)
+{
+    if (QFileInfo(fileName).suffix() == "html") return writeHtml(contest, fileName);
+    if (QFileInfo(fileName).suffix() == "csv") return writeCsv(contest, fileName);
+    if (QFileInfo(fileName).suffix() == "xlsx") return writeXlsx(contest, fileName);
+    if (QFileInfo(fileName).suffix() == "jsonl") return writeJsonLines(contest, fileName);
+    if (QFileInfo(fileName).suffix() == "lrc") return writeColumnar(contest, fileName);
+    return false;
+}
+
+#ifndef LEMON_NO_GUI
+
+void ExportUtil::exportHtml(QWidget *widget, Contest *contest, const QString &fileName)
+{
+    QProgressDialog progress(tr("Exporting result..."), tr("Cancel"), 0, 0, widget);
+    progress.setWindowModality(Qt::WindowModal);
+    progress.setMinimumDuration(500);
+    bool done = writeHtml(contest, fileName, &progress);
+    if (progress.wasCanceled()) return;
+    progress.close();
+    
+    if (! done) {
+        QMessageBox::warning(widget, tr("Lemon"), tr("Cannot open file %1").arg(QFileInfo(fileName).fileName()),
+                             QMessageBox::Ok);
+        return;
+    }
+    QMessageBox::information(widget, tr("Lemon"), tr("Export is done"), QMessageBox::Ok);
+}
+
+void ExportUtil::exportCsv(QWidget *widget, Contest *contest, const QString &fileName)
+{
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    bool done = writeCsv(contest, fileName);
+    QApplication::restoreOverrideCursor();
+    
+    if (! done) {
+        QMessageBox::warning(widget, tr("Lemon"), tr("Cannot open file %1").arg(QFileInfo(fileName).fileName()),
+                             QMessageBox::Ok);
+        return;
+    }
+    QMessageBox::information(widget, tr("Lemon"), tr("Export is done"), QMessageBox::Ok);
+}
+
+void ExportUtil::exportXlsx(QWidget *widget, Contest *contest, const QString &fileName)
+{
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    bool done = writeXlsx(contest, fileName);
+    QApplication::restoreOverrideCursor();
+    
+    if (! done) {
+        QMessageBox::warning(widget, tr("Lemon"), tr("Cannot open file %1").arg(QFileInfo(fileName).fileName()),
+                             QMessageBox::Ok);
+        return;
+    }
+    QMessageBox::information(widget, tr("Lemon"), tr("Export is done"), QMessageBox::Ok);
+}
+
+void ExportUtil::exportDetail(QWidget *widget, Contest *contest, const QString &fileName)
+{
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    bool done = exportToFile(contest, fileName);
     QApplication::restoreOverrideCursor();
+    
+    if (! done) {
+        QMessageBox::warning(widget, tr("Lemon"), tr("Cannot open file %1").arg(QFileInfo(fileName).fileName()),
+                             QMessageBox::Ok);
+        return;
+    }
     QMessageBox::information(widget, tr("Lemon"), tr("Export is done"), QMessageBox::Ok);
 }
 
@@ -356,31 +841,8 @@ void ExportUtil::exportXls(QWidget *widget, Contest *contest, const QString &fil
     
     QApplication::setOverrideCursor(Qt::WaitCursor);
     
-    QList<Contestant*> contestantList = contest->getContestantList();
     QList<Task*> taskList = contest->getTaskList();
-    QList< QPair<int, QString> > sortList;
-    for (int i = 0; i < contestantList.size(); i ++) {
-        int totalScore = contestantList[i]->getTotalScore();
-        if (totalScore != -1) {
-            sortList.append(qMakePair(-totalScore, contestantList[i]->getContestantName()));
-        } else {
-            sortList.append(qMakePair(1, contestantList[i]->getContestantName()));
-        }
-    }
-    qSort(sortList);
-    QMap<QString, int> rankList;
-    for (int i = 0; i < sortList.size(); i ++) {
-        if (i > 0 && sortList[i].first == sortList[i-1].first) {
-            rankList.insert(sortList[i].second, rankList[sortList[i-1].second]);
-        } else {
-            rankList.insert(sortList[i].second, i);
-        }
-    }
-    
-    QMap<Contestant*, int> loc;
-    for (int i = 0; i < contestantList.size(); i ++) {
-        loc.insert(contestantList[i], i);
-    }
+    const RankList &rankList = contest->getRankList();
     
     QAxObject *excel = new QAxObject("Excel.Application", widget);
     QAxObject *workbook = excel->querySubObject("Workbooks")->querySubObject("Add");
@@ -395,11 +857,10 @@ void ExportUtil::exportXls(QWidget *widget, Contest *contest, const QString &fil
     for (int i = 0; i < taskList.size() + 3; i ++)
         sheet->querySubObject("Cells(int, int)", 1, i + 1)->querySubObject("Font")->setProperty("Bold", true);
     
-    for (int i = 0; i < sortList.size(); i ++) {
-        Contestant *contestant = contest->getContestant(sortList[i].second);
-        sheet->querySubObject("Cells(int, int)", 2 + i, 1)->setProperty("Value",
-                                                                        rankList[contestant->getContestantName()] + 1);
-        sheet->querySubObject("Cells(int, int)", 2 + i, 2)->setProperty("Value", sortList[i].second);
+    for (int i = 0; i < rankList.size(); i ++) {
+        Contestant *contestant = rankList.contestantAt(i);
+        sheet->querySubObject("Cells(int, int)", 2 + i, 1)->setProperty("Value", rankList.rankAt(i));
+        sheet->querySubObject("Cells(int, int)", 2 + i, 2)->setProperty("Value", contestant->getContestantName());
         for (int j = 0; j < taskList.size(); j ++) {
             int score = contestant->getTaskScore(j);
             if (score != -1) {
@@ -438,7 +899,8 @@ void ExportUtil::exportResult(QWidget *widget, Contest *contest)
         return;
     }
     
-    QString filter = tr("HTML Document (*.html);;CSV (*.csv)");
+    QString filter = tr("HTML Document (*.html);;CSV (*.csv);;Office Open XML Workbook (*.xlsx)"
+                        ";;JSON Lines (*.jsonl);;Columnar Results (*.lrc)");
     
 #ifdef Q_OS_WIN32
     QAxObject *excel = new QAxObject("Excel.Application", widget);
@@ -452,5 +914,10 @@ void ExportUtil::exportResult(QWidget *widget, Contest *contest)
     
     if (QFileInfo(fileName).suffix() == "html") exportHtml(widget, contest, fileName);
     if (QFileInfo(fileName).suffix() == "csv") exportCsv(widget, contest, fileName);
+    if (QFileInfo(fileName).suffix() == "xlsx") exportXlsx(widget, contest, fileName);
+    if (QFileInfo(fileName).suffix() == "jsonl") exportDetail(widget, contest, fileName);
+    if (QFileInfo(fileName).suffix() == "lrc") exportDetail(widget, contest, fileName);
     if (QFileInfo(fileName).suffix() == "xls") exportXls(widget, contest, fileName);
 }
+
+#endif
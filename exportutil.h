@@ -20,28 +20,48 @@
 #define EXPORTUTIL_H
 
 #include <QtCore>
-#include <QtGui>
 #include <QObject>
+#include "globaltype.h"
 
+#ifndef LEMON_NO_GUI
+#include <QtGui>
 #ifdef Q_OS_WIN32
 #include <QAxObject>
 #endif
+#endif
 
 class Contest;
 class Contestant;
+class QProgressDialog;
 
 class ExportUtil : public QObject
 {
     Q_OBJECT
+    friend class HtmlRenderThread;
 public:
     explicit ExportUtil(QObject *parent = 0);
+    static bool exportToFile(Contest*, const QString&);
+    static QString getResultText(ResultState);
+#ifndef LEMON_NO_GUI
     static void exportResult(QWidget*, Contest*);
+#endif
 
 private:
     static QString getContestantHtmlCode(Contest*, Contestant*);
+    static bool writeHtml(Contest*, const QString&, QProgressDialog* = 0);
+    static bool writeCsv(Contest*, const QString&);
+    static bool writeXlsx(Contest*, const QString&);
+    static bool writeJsonLines(Contest*, const QString&);
+    static bool writeColumnar(Contest*, const QString&);
+    static const char* getResultName(ResultState);
+    static void appendJsonString(QByteArray&, const QString&);
+#ifndef LEMON_NO_GUI
     static void exportHtml(QWidget*, Contest*, const QString&);
     static void exportCsv(QWidget*, Contest*, const QString&);
+    static void exportXlsx(QWidget*, Contest*, const QString&);
+    static void exportDetail(QWidget*, Contest*, const QString&);
     static void exportXls(QWidget*, Contest*, const QString&);
+#endif
     
 signals:
     
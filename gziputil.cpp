@@ -0,0 +1,109 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include "gziputil.h"
+#include <cstring>
+#include <zlib.h>
+
+static const int bufferSize = 1 << 16;
+
+// Inflates every gzip member of the input. Anything after a complete
+// member that does not start a new one is ignored as trailing garbage,
+// the same way gzip itself treats it. The output device may be 0 when
+// only the size is wanted.
+static bool inflateFile(QFile &input, QIODevice *output, qint64 &size)
+{
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK) return false;
+    
+    QByteArray inputBuffer(bufferSize, 0);
+    QByteArray outputBuffer(bufferSize, 0);
+    bool memberFinished = false;
+    bool succeeded = false;
+    size = 0;
+    while (true) {
+        if (stream.avail_in < 2 && ! input.atEnd()) {
+            if (stream.avail_in > 0) memmove(inputBuffer.data(), stream.next_in, stream.avail_in);
+            qint64 length = input.read(inputBuffer.data() + stream.avail_in, bufferSize - stream.avail_in);
+            if (length < 0) break;
+            stream.next_in = (Bytef*)(inputBuffer.data());
+            stream.avail_in += uInt(length);
+        }
+        if (memberFinished) {
+            if (stream.avail_in < 2 || stream.next_in[0] != 0x1f || stream.next_in[1] != 0x8b) {
+                succeeded = true;
+                break;
+            }
+            if (inflateReset(&stream) != Z_OK) break;
+            memberFinished = false;
+        }
+        if (stream.avail_in == 0) break;
+        
+        stream.next_out = (Bytef*)(outputBuffer.data());
+        stream.avail_out = bufferSize;
+        int result = inflate(&stream, Z_NO_FLUSH);
+        if (result != Z_OK && result != Z_STREAM_END) break;
+        qint64 length = bufferSize - stream.avail_out;
+        if (output && length > 0 && output->write(outputBuffer.constData(), length) != length) break;
+        size += length;
+        if (result == Z_STREAM_END) memberFinished = true;
+    }
+    inflateEnd(&stream);
+    return succeeded;
+}
+
+bool GzipUtil::isCompressed(const QString &fileName)
+{
+    return fileName.endsWith(".gz", Qt::CaseInsensitive);
+}
+
+QString GzipUtil::uncompressedName(const QString &fileName)
+{
+    if (! isCompressed(fileName)) return fileName;
+    return fileName.left(fileName.length() - 3);
+}
+
+qint64 GzipUtil::uncompressedSize(const QString &fileName)
+{
+    QFile file(fileName);
+    if (! file.open(QFile::ReadOnly)) return -1;
+    qint64 size;
+    if (! inflateFile(file, 0, size)) return -1;
+    return size;
+}
+
+bool GzipUtil::decompress(const QString &source, const QString &target)
+{
+    QFile input(source);
+    if (! input.open(QFile::ReadOnly)) return false;
+    QFile output(target);
+    if (! output.open(QFile::WriteOnly | QFile::Truncate)) return false;
+    
+    qint64 size;
+    bool succeeded = inflateFile(input, &output, size) && output.flush();
+    output.close();
+    if (! succeeded) QFile::remove(target);
+    return succeeded;
+}
+
+bool GzipUtil::copyFile(const QString &source, const QString &target)
+{
+    if (isCompressed(source)) return decompress(source, target);
+    return QFile::copy(source, target);
+}
@@ -0,0 +1,147 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include "judgingcache.h"
+#include "filehashsource.h"
+
+static const int maxCacheCost = 64 * 1024 * 1024;
+
+JudgingCache::JudgingCache(QObject *parent) :
+    QObject(parent)
+{
+    hashSource = 0;
+    entries.setMaxCost(maxCacheCost);
+}
+
+void JudgingCache::setHashSource(FileHashSource *source)
+{
+    hashSource = source;
+}
+
+QByteArray JudgingCache::getFileHash(const QString &fileName)
+{
+    QFileInfo info(fileName);
+    if (! info.exists()) return QByteArray();
+    QString path = info.absoluteFilePath();
+    
+    if (hashSource) {
+        QByteArray hash = hashSource->getFileHash(path);
+        if (! hash.isEmpty()) return hash;
+    }
+    
+    mutex.lock();
+    if (fileHashes.contains(path)) {
+        const FileStamp &stamp = fileHashes[path];
+        if (stamp.size == info.size() && stamp.lastModified == info.lastModified()) {
+            QByteArray hash = stamp.hash;
+            mutex.unlock();
+            return hash;
+        }
+    }
+    mutex.unlock();
+    
+    FileStamp stamp;
+    stamp.size = info.size();
+    stamp.lastModified = info.lastModified();
+    stamp.hash = hashFile(path);
+    if (stamp.hash.isEmpty()) return QByteArray();
+    
+    QMutexLocker locker(&mutex);
+    fileHashes.insert(path, stamp);
+    return stamp.hash;
+}
+
+bool JudgingCache::lookUp(const QByteArray &key, Entry &entry)
+{
+    QMutexLocker locker(&mutex);
+    Entry *cached = entries.object(key);
+    if (! cached) return false;
+    entry = *cached;
+    return true;
+}
+
+void JudgingCache::insert(const QByteArray &key, const Entry &entry)
+{
+    // Cost is the approximate memory of an entry; the least recently used go first
+    int cost = key.size() + int(sizeof(Entry)) + entry.message.size() * int(sizeof(QChar));
+    QMutexLocker locker(&mutex);
+    entries.insert(key, new Entry(entry), cost);
+}
+
+void JudgingCache::invalidateFiles(const QStringList &fileNames)
+{
+    QMutexLocker locker(&mutex);
+    for (int i = 0; i < fileNames.size(); i ++) {
+        fileHashes.remove(QFileInfo(fileNames[i]).absoluteFilePath());
+    }
+}
+
+void JudgingCache::clear()
+{
+    QMutexLocker locker(&mutex);
+    fileHashes.clear();
+    entries.clear();
+}
+
+int JudgingCache::size() const
+{
+    QMutexLocker locker(&mutex);
+    return entries.size();
+}
+
+QByteArray JudgingCache::hashFile(const QString &fileName)
+{
+    QFile file(fileName);
+    if (! file.open(QFile::ReadOnly)) return QByteArray();
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    while (! file.atEnd()) {
+        hash.addData(file.read(1024 * 1024));
+    }
+    file.close();
+    return hash.result();
+}
+
+QByteArray JudgingCache::hashDirectory(const QString &path)
+{
+    QDir dir(path);
+    if (! dir.exists()) return QByteArray();
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    QStringList list = dir.entryList(QDir::Files, QDir::Name);
+    for (int i = 0; i < list.size(); i ++) {
+        QByteArray fileHash = hashFile(dir.filePath(list[i]));
+        if (fileHash.isEmpty()) return QByteArray();
+        hash.addData(list[i].toUtf8());
+        hash.addData(fileHash);
+    }
+    return hash.result();
+}
+
+bool JudgingCache::isCacheable(ResultState result)
+{
+    return result == CorrectAnswer || result == WrongAnswer || result == PartlyCorrect;
+}
+
+double JudgingCache::safeTimeRatio()
+{
+    return 0.8;
+}
+
+double JudgingCache::safeMemoryRatio()
+{
+    return 0.9;
+}
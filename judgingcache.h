@@ -0,0 +1,67 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#ifndef JUDGINGCACHE_H
+#define JUDGINGCACHE_H
+
+#include <QtCore>
+#include <QObject>
+#include "globaltype.h"
+
+class FileHashSource;
+
+class JudgingCache : public QObject
+{
+    Q_OBJECT
+public:
+    struct Entry {
+        int timeUsed;
+        int memoryUsed;
+        int score;
+        ResultState result;
+        QString message;
+    };
+    
+    explicit JudgingCache(QObject *parent = 0);
+    void setHashSource(FileHashSource*);
+    QByteArray getFileHash(const QString&);
+    bool lookUp(const QByteArray&, Entry&);
+    void insert(const QByteArray&, const Entry&);
+    void invalidateFiles(const QStringList&);
+    void clear();
+    int size() const;
+    static QByteArray hashFile(const QString&);
+    static QByteArray hashDirectory(const QString&);
+    static bool isCacheable(ResultState);
+    static double safeTimeRatio();
+    static double safeMemoryRatio();
+
+private:
+    struct FileStamp {
+        qint64 size;
+        QDateTime lastModified;
+        QByteArray hash;
+    };
+    
+    FileHashSource *hashSource;
+    mutable QMutex mutex;
+    QHash<QString, FileStamp> fileHashes;
+    QCache<QByteArray, Entry> entries;
+};
+
+#endif // JUDGINGCACHE_H
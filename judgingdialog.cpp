@@ -1,223 +1,261 @@
-/***************************************************************************
-    This file is part of Project Lemon
-    Copyright (C) 2011 Zhipeng Jia
-
-    This program is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    This program is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with this program.  If not, see <http://www.gnu.org/licenses/>.
-***************************************************************************/
-
-#include "judgingdialog.h"
-#include "ui_judgingdialog.h"
-#include "contest.h"
-#include "task.h"
-
-JudgingDialog::JudgingDialog(QWidget *parent) :
-    QDialog(parent),
-    ui(new Ui::JudgingDialog)
-{
-    ui->setupUi(this);
-    cursor = new QTextCursor(ui->logViewer->document());
-    connect(ui->cancelButton, SIGNAL(clicked()),
-            this, SLOT(stopJudgingSlot()));
-}
-
-JudgingDialog::~JudgingDialog()
-{
-    delete ui;
-    delete cursor;
-}
-
-void JudgingDialog::setContest(Contest *contest)
-{
-    curContest = contest;
-    connect(curContest, SIGNAL(singleCaseFinished(int, int, int, int)),
-            this, SLOT(singleCaseFinished(int, int, int, int)));
-    connect(curContest, SIGNAL(taskJudgingStarted(QString)),
-            this, SLOT(taskJudgingStarted(QString)));
-    connect(curContest, SIGNAL(contestantJudgingStart(QString)),
-            this, SLOT(contestantJudgingStart(QString)));
-    connect(curContest, SIGNAL(contestantJudgingFinished()),
-            this, SLOT(contestantJudgingFinished()));
-    connect(curContest, SIGNAL(compileError(int, int)),
-            this, SLOT(compileError(int, int)));
-    connect(this, SIGNAL(stopJudgingSignal()),
-            curContest, SLOT(stopJudgingSlot()));
-}
-
-void JudgingDialog::judge(const QStringList &nameList)
-{
-    stopJudging = false;
-    ui->progressBar->setMaximum(curContest->getTotalTimeLimit() * nameList.size());
-    for (int i = 0; i < nameList.size(); i ++) {
-        curContest->judge(nameList[i]);
-        if (stopJudging) break;
-    }
-    accept();
-}
-
-void JudgingDialog::judge(const QString &name, int index)
-{
-    stopJudging = false;
-    ui->progressBar->setMaximum(curContest->getTask(index)->getTotalTimeLimit());
-    curContest->judge(name, index);
-    accept();
-}
-
-void JudgingDialog::judgeAll()
-{
-    stopJudging = false;
-    ui->progressBar->setMaximum(curContest->getTotalTimeLimit() * curContest->getContestantList().size());
-    curContest->judgeAll();
-    accept();
-}
-
-void JudgingDialog::singleCaseFinished(int progress, int x, int y, int result)
-{
-    QTextBlockFormat blockFormat;
-    blockFormat.setLeftMargin(30);
-    cursor->insertBlock(blockFormat);
-    QTextCharFormat charFormat;
-    charFormat.setFontPointSize(9);
-    cursor->insertText(tr("Test case %1.%2: ").arg(x + 1).arg(y + 1), charFormat);
-    
-    QString text;
-    switch (ResultState(result)) {
-        case CorrectAnswer:
-            text = tr("Correct answer");
-            charFormat.setForeground(QBrush(Qt::darkGreen));
-            break;
-        case WrongAnswer:
-            text = tr("Wrong answer");
-            charFormat.setForeground(QBrush(Qt::red));
-            break;
-        case PartlyCorrect:
-            text = tr("Partly correct");
-            charFormat.setForeground(QBrush(Qt::darkYellow));
-            break;
-        case TimeLimitExceeded:
-            text = tr("Time limit exceeded");
-            charFormat.setForeground(QBrush(Qt::red));
-            break;
-        case MemoryLimitExceeded:
-            text = tr("Memory limit exceeded");
-            charFormat.setForeground(QBrush(Qt::red));
-            break;
-        case CannotStartProgram:
-            text = tr("Cannot start program");
-            charFormat.setForeground(QBrush(Qt::red));
-            break;
-        case FileError:
-            text = tr("File error");
-            charFormat.setForeground(QBrush(Qt::red));
-            break;
-        case RunTimeError:
-            text = tr("Run time error");
-            charFormat.setForeground(QBrush(Qt::red));
-            break;
-        case InvalidSpecialJudge:
-            text = tr("Invalid special judge");
-            charFormat.setForeground(QBrush(Qt::darkBlue));
-            break;
-        case SpecialJudgeTimeLimitExceeded:
-            text = tr("Special judge time limit exceeded");
-            charFormat.setForeground(QBrush(Qt::darkBlue));
-            break;
-        case SpecialJudgeRunTimeError:
-            text = tr("Special judge run time error");
-            charFormat.setForeground(QBrush(Qt::darkBlue));
-            break;
-    }
-    
-    cursor->insertText(text, charFormat);
-    ui->progressBar->setValue(ui->progressBar->value() + progress);
-    
-    QScrollBar *bar = ui->logViewer->verticalScrollBar();
-    bar->setValue(bar->maximum());
-}
-
-void JudgingDialog::taskJudgingStarted(const QString &taskName)
-{
-    QTextBlockFormat blockFormat;
-    blockFormat.setLeftMargin(15);
-    cursor->insertBlock(blockFormat);
-    QTextCharFormat charFormat;
-    charFormat.setFontPointSize(9);
-    cursor->insertText(tr("Start judging task %1").arg(taskName), charFormat);
-    QScrollBar *bar = ui->logViewer->verticalScrollBar();
-    bar->setValue(bar->maximum());
-}
-
-void JudgingDialog::contestantJudgingStart(const QString &contestantName)
-{
-    QTextCharFormat charFormat;
-    charFormat.setFontPointSize(10);
-    charFormat.setFontWeight(QFont::Bold);
-    cursor->insertText(tr("Start judging contestant %1").arg(contestantName), charFormat);
-    QScrollBar *bar = ui->logViewer->verticalScrollBar();
-    bar->setValue(bar->maximum());
-}
-
-void JudgingDialog::contestantJudgingFinished()
-{
-    QTextBlockFormat blockFormat;
-    cursor->insertBlock(blockFormat);
-    cursor->insertBlock(blockFormat);
-    QScrollBar *bar = ui->logViewer->verticalScrollBar();
-    bar->setValue(bar->maximum());
-}
-
-void JudgingDialog::compileError(int progress, int compileState)
-{
-    QTextBlockFormat blockFormat;
-    blockFormat.setLeftMargin(30);
-    cursor->insertBlock(blockFormat);
-    QTextCharFormat charFormat;
-    charFormat.setFontPointSize(9);
-    
-    QString text;
-    switch (CompileState(compileState)) {
-        case NoValidSourceFile:
-            text = tr("Cannot find valid source file");
-            charFormat.setForeground(QBrush(Qt::red));
-            break;
-        case CompileError:
-            text = tr("Compile error");
-            charFormat.setForeground(QBrush(Qt::red));
-            break;
-        case CompileTimeLimitExceeded:
-            text = tr("Compile time limit exceeded");
-            charFormat.setForeground(QBrush(Qt::red));
-            break;
-        case InvalidCompiler:
-            text = tr("Invalid compiler");
-            charFormat.setForeground(QBrush(Qt::blue));
-            break;
-    }
-    
-    cursor->insertText(text, charFormat);
-    ui->progressBar->setValue(ui->progressBar->value() + progress);
-    
-    QScrollBar *bar = ui->logViewer->verticalScrollBar();
-    bar->setValue(bar->maximum());
-}
-
-void JudgingDialog::stopJudgingSlot()
-{
-    stopJudging = true;
-    emit stopJudgingSignal();
-}
-
-void JudgingDialog::reject()
-{
-    stopJudgingSlot();
-}
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include "judgingdialog.h"
+#include "ui_judgingdialog.h"
+#include "contest.h"
+#include "task.h"
+#include "judgingjournal.h"
+
+JudgingDialog::JudgingDialog(QWidget *parent) :
+    QDialog(parent),
+    ui(new Ui::JudgingDialog)
+{
+    ui->setupUi(this);
+    logModel = new JudgingLogModel(this);
+    ui->logViewer->setModel(logModel);
+    pendingProgress = 0;
+    refreshTimer = new QTimer(this);
+    refreshTimer->setInterval(100);
+    connect(refreshTimer, SIGNAL(timeout()),
+            this, SLOT(flushLog()));
+    refreshTimer->start();
+    connect(ui->cancelButton, SIGNAL(clicked()),
+            this, SLOT(stopJudgingSlot()));
+}
+
+JudgingDialog::~JudgingDialog()
+{
+    delete ui;
+}
+
+void JudgingDialog::setContest(Contest *contest)
+{
+    curContest = contest;
+    connect(curContest, SIGNAL(singleCaseFinished(int, int, int, int)),
+            this, SLOT(singleCaseFinished(int, int, int, int)));
+    connect(curContest, SIGNAL(taskJudgingStarted(QString)),
+            this, SLOT(taskJudgingStarted(QString)));
+    connect(curContest, SIGNAL(contestantJudgingStart(QString)),
+            this, SLOT(contestantJudgingStart(QString)));
+    connect(curContest, SIGNAL(contestantJudgingFinished()),
+            this, SLOT(contestantJudgingFinished()));
+    connect(curContest, SIGNAL(compileError(int, int)),
+            this, SLOT(compileError(int, int)));
+    connect(this, SIGNAL(stopJudgingSignal()),
+            curContest, SLOT(stopJudgingSlot()));
+}
+
+void JudgingDialog::judge(const QStringList &nameList)
+{
+    stopJudging = false;
+    ui->progressBar->setMaximum(curContest->getTotalTimeLimit() * nameList.size());
+    curContest->judge(nameList);
+    accept();
+}
+
+void JudgingDialog::judge(const QString &name, int index)
+{
+    stopJudging = false;
+    ui->progressBar->setMaximum(curContest->getTask(index)->getTotalTimeLimit());
+    curContest->judge(name, index);
+    accept();
+}
+
+void JudgingDialog::judgeAll()
+{
+    stopJudging = false;
+    ui->progressBar->setMaximum(curContest->getTotalTimeLimit() * curContest->getContestantList().size());
+    curContest->judgeAll();
+    accept();
+}
+
+void JudgingDialog::resumeJudging()
+{
+    stopJudging = false;
+    ui->progressBar->setMaximum(curContest->getTotalTimeLimit()
+                                * curContest->getJudgingJournal()->getRunContestants().size());
+    curContest->resumeJudging();
+    accept();
+}
+
+void JudgingDialog::singleCaseFinished(int progress, int x, int y, int result)
+{
+    QColor color;
+    QString text = resultText(result, &color);
+    appendEntry(tr("Test case %1.%2: ").arg(x + 1).arg(y + 1) + text, 2, color, false, result);
+    verdictCount[result] ++;
+    pendingProgress += progress;
+}
+
+void JudgingDialog::taskJudgingStarted(const QString &taskName)
+{
+    appendEntry(tr("Start judging task %1").arg(taskName), 1);
+}
+
+void JudgingDialog::contestantJudgingStart(const QString &contestantName)
+{
+    appendEntry(tr("Start judging contestant %1").arg(contestantName), 0, QColor(Qt::black), true);
+}
+
+void JudgingDialog::contestantJudgingFinished()
+{
+    appendEntry("", 0);
+}
+
+void JudgingDialog::compileError(int progress, int compileState)
+{
+    QString text;
+    QColor color(Qt::red);
+    switch (CompileState(compileState)) {
+        case NoValidSourceFile:
+            text = tr("Cannot find valid source file");
+            break;
+        case CompileError:
+            text = tr("Compile error");
+            break;
+        case CompileTimeLimitExceeded:
+            text = tr("Compile time limit exceeded");
+            break;
+        case InvalidCompiler:
+            text = tr("Invalid compiler");
+            color = QColor(Qt::blue);
+            break;
+    }
+    
+    appendEntry(text, 2, color);
+    pendingProgress += progress;
+}
+
+void JudgingDialog::appendEntry(const QString &text, int level, const QColor &color, bool bold, int result)
+{
+    JudgingLogEntry entry;
+    entry.text = text;
+    entry.level = level;
+    entry.color = color;
+    entry.bold = bold;
+    entry.result = result;
+    pendingEntries.append(entry);
+}
+
+void JudgingDialog::flushLog()
+{
+    int caseCount = 0;
+    for (int i = 0; i < pendingEntries.size(); i ++) {
+        if (pendingEntries[i].result != -1) caseCount ++;
+    }
+    
+    QList<JudgingLogEntry> lines;
+    for (int i = 0; i < pendingEntries.size(); i ++) {
+        if (caseCount <= 20 || pendingEntries[i].result == -1) {
+            lines.append(pendingEntries[i]);
+            continue;
+        }
+        QMap<int, int> count;
+        int total = 0;
+        for (; i < pendingEntries.size() && pendingEntries[i].result != -1; i ++) {
+            count[pendingEntries[i].result] ++;
+            total ++;
+        }
+        i --;
+        QStringList parts;
+        QMap<int, int>::const_iterator iter;
+        for (iter = count.constBegin(); iter != count.constEnd(); ++ iter) {
+            parts.append(QString("%1 %2").arg(iter.value()).arg(resultText(iter.key(), 0)));
+        }
+        JudgingLogEntry entry;
+        entry.text = tr("%1 test cases finished: %2").arg(total).arg(parts.join(", "));
+        entry.level = 2;
+        lines.append(entry);
+    }
+    pendingEntries.clear();
+    
+    if (! lines.isEmpty()) {
+        logModel->appendEntries(lines);
+        ui->logViewer->scrollToBottom();
+    }
+    if (pendingProgress > 0) {
+        ui->progressBar->setValue(ui->progressBar->value() + pendingProgress);
+        pendingProgress = 0;
+        QStringList parts;
+        QMap<int, int>::const_iterator iter;
+        for (iter = verdictCount.constBegin(); iter != verdictCount.constEnd(); ++ iter) {
+            parts.append(QString("%1: %2").arg(resultText(iter.key(), 0)).arg(iter.value()));
+        }
+        ui->summaryLabel->setText(parts.join("    "));
+    }
+}
+
+QString JudgingDialog::resultText(int result, QColor *color) const
+{
+    QString text;
+    QColor textColor(Qt::red);
+    switch (ResultState(result)) {
+        case CorrectAnswer:
+            text = tr("Correct answer");
+            textColor = QColor(Qt::darkGreen);
+            break;
+        case WrongAnswer:
+            text = tr("Wrong answer");
+            break;
+        case PartlyCorrect:
+            text = tr("Partly correct");
+            textColor = QColor(Qt::darkYellow);
+            break;
+        case TimeLimitExceeded:
+            text = tr("Time limit exceeded");
+            break;
+        case MemoryLimitExceeded:
+            text = tr("Memory limit exceeded");
+            break;
+        case CannotStartProgram:
+            text = tr("Cannot start program");
+            break;
+        case FileError:
+            text = tr("File error");
+            break;
+        case RunTimeError:
+            text = tr("Run time error");
+            break;
+        case InvalidSpecialJudge:
+            text = tr("Invalid special judge");
+            textColor = QColor(Qt::darkBlue);
+            break;
+        case SpecialJudgeTimeLimitExceeded:
+            text = tr("Special judge time limit exceeded");
+            textColor = QColor(Qt::darkBlue);
+            break;
+        case SpecialJudgeRunTimeError:
+            text = tr("Special judge run time error");
+            textColor = QColor(Qt::darkBlue);
+            break;
+    }
+    if (color) *color = textColor;
+    return text;
+}
+
+void JudgingDialog::stopJudgingSlot()
+{
+    stopJudging = true;
+    emit stopJudgingSignal();
+}
+
+void JudgingDialog::reject()
+{
+    stopJudgingSlot();
+}
@@ -0,0 +1,169 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include "judgingjob.h"
+#include "judgingthread.h"
+
+JudgingJob::JudgingJob()
+{
+    checkRejudgeMode = false;
+    extraTimeRatio = 0;
+    specialJudgeTimeLimit = 0;
+    fullScore = 0;
+    timeLimit = 0;
+    memoryLimit = -1;
+}
+
+void JudgingJob::setUpThread(JudgingThread *thread) const
+{
+    QProcessEnvironment env;
+    for (int i = 0; i < environment.size(); i ++) {
+        int tmp = environment[i].indexOf('=');
+        env.insert(environment[i].mid(0, tmp), environment[i].mid(tmp + 1));
+    }
+    thread->setCheckRejudgeMode(checkRejudgeMode);
+    thread->setExtraTimeRatio(extraTimeRatio);
+    thread->setEnvironment(env);
+    thread->setWorkingDirectory(workingDirectory);
+    thread->setSpecialJudgeTimeLimit(specialJudgeTimeLimit);
+    thread->setExecutableFile(executableFile);
+    thread->setArguments(arguments);
+    thread->setAnswerFile(answerFile);
+    thread->setInputFile(inputFile);
+    thread->setOutputFile(outputFile);
+    thread->setInputDataFile(inputDataFile);
+    thread->setOutputDataFile(outputDataFile);
+    thread->setDiffPath(diffPath);
+    thread->setFullScore(fullScore);
+    thread->setTimeLimit(timeLimit);
+    thread->setMemoryLimit(memoryLimit);
+    thread->setExecutableHash(executableHash);
+}
+
+void JudgingJob::writeToStream(QDataStream &out) const
+{
+    out << contestPath;
+    out << taskData;
+    out << checkRejudgeMode;
+    out << extraTimeRatio;
+    out << environment;
+    out << workingDirectory;
+    out << specialJudgeTimeLimit;
+    out << executableFile;
+    out << arguments;
+    out << answerFile;
+    out << inputFile;
+    out << outputFile;
+    out << inputDataFile;
+    out << outputDataFile;
+    out << diffPath;
+    out << fullScore;
+    out << timeLimit;
+    out << memoryLimit;
+    out << executableHash;
+}
+
+void JudgingJob::readFromStream(QDataStream &in)
+{
+    in >> contestPath;
+    in >> taskData;
+    in >> checkRejudgeMode;
+    in >> extraTimeRatio;
+    in >> environment;
+    in >> workingDirectory;
+    in >> specialJudgeTimeLimit;
+    in >> executableFile;
+    in >> arguments;
+    in >> answerFile;
+    in >> inputFile;
+    in >> outputFile;
+    in >> inputDataFile;
+    in >> outputDataFile;
+    in >> diffPath;
+    in >> fullScore;
+    in >> timeLimit;
+    in >> memoryLimit;
+    in >> executableHash;
+}
+
+void JudgingJob::writeMessage(QIODevice *device, MessageType type, qint64 id, const QByteArray &payload)
+{
+    QByteArray block;
+    QDataStream out(&block, QIODevice::WriteOnly);
+    out << quint32(0) << quint8(type) << id << payload;
+    out.device()->seek(0);
+    out << quint32(block.size() - sizeof(quint32));
+    device->write(block);
+}
+
+bool JudgingJob::readMessage(QByteArray &buffer, MessageType &type, qint64 &id, QByteArray &payload)
+{
+    if (buffer.size() < int(sizeof(quint32))) return false;
+    QDataStream in(buffer);
+    quint32 length;
+    in >> length;
+    if (quint32(buffer.size()) < sizeof(quint32) + length) return false;
+    quint8 _type;
+    in >> _type >> id >> payload;
+    type = MessageType(_type);
+    buffer.remove(0, sizeof(quint32) + length);
+    return true;
+}
+
+JudgingJobResult::JudgingJobResult()
+{
+    timeUsed = -1;
+    memoryUsed = -1;
+    score = 0;
+    result = CannotStartProgram;
+    needRejudge = false;
+}
+
+void JudgingJobResult::takeFrom(JudgingThread *thread)
+{
+    timeUsed = thread->getTimeUsed();
+    memoryUsed = thread->getMemoryUsed();
+    score = thread->getScore();
+    result = thread->getResult();
+    message = thread->getMessage();
+    needRejudge = thread->getNeedRejudge();
+}
+
+void JudgingJobResult::writeToStream(QDataStream &out) const
+{
+    out << timeUsed;
+    out << memoryUsed;
+    out << score;
+    out << int(result);
+    out << message;
+    out << messageBlob;
+    out << needRejudge;
+}
+
+void JudgingJobResult::readFromStream(QDataStream &in)
+{
+    int tmp;
+    in >> timeUsed;
+    in >> memoryUsed;
+    in >> score;
+    in >> tmp;
+    result = ResultState(tmp);
+    in >> message;
+    in >> messageBlob;
+    in >> needRejudge;
+}
@@ -0,0 +1,73 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#ifndef JUDGINGJOB_H
+#define JUDGINGJOB_H
+
+#include <QtCore>
+#include "globaltype.h"
+
+class JudgingThread;
+
+struct JudgingJob
+{
+    enum MessageType { HelloMessage, JobMessage, CancelMessage, ResultMessage };
+    
+    JudgingJob();
+    QString contestPath;
+    QByteArray taskData;
+    bool checkRejudgeMode;
+    double extraTimeRatio;
+    QStringList environment;
+    QString workingDirectory;
+    int specialJudgeTimeLimit;
+    QString executableFile;
+    QString arguments;
+    QString answerFile;
+    QString inputFile;
+    QString outputFile;
+    QString inputDataFile;
+    QString outputDataFile;
+    QString diffPath;
+    int fullScore;
+    int timeLimit;
+    int memoryLimit;
+    QByteArray executableHash;
+    void setUpThread(JudgingThread*) const;
+    void writeToStream(QDataStream&) const;
+    void readFromStream(QDataStream&);
+    static void writeMessage(QIODevice*, MessageType, qint64, const QByteArray&);
+    static bool readMessage(QByteArray&, MessageType&, qint64&, QByteArray&);
+};
+
+struct JudgingJobResult
+{
+    JudgingJobResult();
+    int timeUsed;
+    int memoryUsed;
+    int score;
+    ResultState result;
+    QString message;
+    QByteArray messageBlob;
+    bool needRejudge;
+    void takeFrom(JudgingThread*);
+    void writeToStream(QDataStream&) const;
+    void readFromStream(QDataStream&);
+};
+
+#endif // JUDGINGJOB_H
@@ -0,0 +1,364 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include "judgingjournal.h"
+#include "contest.h"
+#include "contestant.h"
+#include "task.h"
+#include "testcase.h"
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+#ifdef Q_OS_WIN32
+#include <windows.h>
+#include <io.h>
+#endif
+
+JudgingJournal::JudgingJournal(QObject *parent) :
+    QObject(parent)
+{
+    file = 0;
+    resetState();
+}
+
+JudgingJournal::~JudgingJournal()
+{
+    close();
+}
+
+QString JudgingJournal::journalFileName(const QString &contestFileName)
+{
+    return QFileInfo(contestFileName).absoluteFilePath() + ".journal";
+}
+
+bool JudgingJournal::open(const QString &fileName, Contest *contest)
+{
+    close();
+    QMutexLocker locker(&mutex);
+    
+    file = new QFile(fileName);
+    if (! file->open(QFile::ReadWrite)) {
+        delete file;
+        file = 0;
+        return false;
+    }
+    
+    QDataStream in(file);
+    qint64 validSize = 0;
+    while (! file->atEnd()) {
+        quint32 length;
+        quint16 checksum;
+        in >> length >> checksum;
+        if (in.status() != QDataStream::Ok) break;
+        QByteArray data = file->read(length);
+        if (quint32(data.size()) != length || qChecksum(data.data(), data.size()) != checksum) break;
+        applyRecord(data, contest);
+        validSize = file->pos();
+    }
+    
+    file->resize(validSize);
+    file->seek(validSize);
+    return true;
+}
+
+void JudgingJournal::close()
+{
+    QMutexLocker locker(&mutex);
+    if (file) {
+        file->close();
+        delete file;
+        file = 0;
+    }
+    resetState();
+}
+
+void JudgingJournal::clear()
+{
+    QMutexLocker locker(&mutex);
+    if (file) {
+        file->resize(0);
+        file->seek(0);
+    }
+    resetState();
+}
+
+bool JudgingJournal::isOpen() const
+{
+    QMutexLocker locker(&mutex);
+    return file != 0;
+}
+
+bool JudgingJournal::hasUnfinishedRun() const
+{
+    QMutexLocker locker(&mutex);
+    return runInProgress;
+}
+
+QStringList JudgingJournal::getRunContestants() const
+{
+    QMutexLocker locker(&mutex);
+    return runContestants;
+}
+
+int JudgingJournal::getRunTaskIndex() const
+{
+    QMutexLocker locker(&mutex);
+    return runTaskIndex;
+}
+
+bool JudgingJournal::isTaskFinished(const QString &contestantName, int taskIndex) const
+{
+    QMutexLocker locker(&mutex);
+    return finishedTasks.contains(qMakePair(contestantName, taskIndex));
+}
+
+QMap< QPair<int, int>, JudgingJobResult > JudgingJournal::getFinishedCases(const QString &contestantName,
+                                                                           int taskIndex) const
+{
+    QMutexLocker locker(&mutex);
+    return finishedCases.value(qMakePair(contestantName, taskIndex));
+}
+
+void JudgingJournal::runStarted(const QStringList &contestants, int taskIndex)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out << int(RunStartedRecord) << contestants << taskIndex;
+    
+    QMutexLocker locker(&mutex);
+    resetState();
+    runInProgress = true;
+    runContestants = contestants;
+    runTaskIndex = taskIndex;
+    writeRecord(data);
+}
+
+void JudgingJournal::caseFinished(const QString &contestantName, int taskIndex,
+                                  int testCaseIndex, int singleCaseIndex, const JudgingJobResult &result)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out << int(CaseFinishedRecord) << contestantName << taskIndex << testCaseIndex << singleCaseIndex;
+    result.writeToStream(out);
+    
+    QMutexLocker locker(&mutex);
+    if (! runInProgress) return;
+    finishedCases[qMakePair(contestantName, taskIndex)][qMakePair(testCaseIndex, singleCaseIndex)] = result;
+    writeRecord(data);
+}
+
+void JudgingJournal::taskFinished(Contestant *contestant, int taskIndex, const QString &problemTitle)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out << int(TaskFinishedRecord) << contestant->getContestantName() << taskIndex << problemTitle;
+    out << int(contestant->getCompileState(taskIndex));
+    out << contestant->getSourceFile(taskIndex);
+    out << contestant->getCompileMessage(taskIndex);
+    out << contestant->getCompileMessageBlob(taskIndex);
+    contestant->getResultTable(taskIndex).writeToStream(out);
+    
+    QMutexLocker locker(&mutex);
+    if (! runInProgress) return;
+    QPair<QString, int> key = qMakePair(contestant->getContestantName(), taskIndex);
+    finishedCases.remove(key);
+    finishedTasks.insert(key);
+    writeRecord(data);
+}
+
+void JudgingJournal::contestantFinished(Contestant *contestant)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out << int(ContestantFinishedRecord) << contestant->getContestantName() << contestant->getJudingTime();
+    
+    QMutexLocker locker(&mutex);
+    if (! runInProgress) return;
+    writeRecord(data);
+}
+
+void JudgingJournal::runFinished()
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out << int(RunFinishedRecord);
+    
+    QMutexLocker locker(&mutex);
+    if (! runInProgress) return;
+    resetState();
+    writeRecord(data);
+}
+
+qint64 JudgingJournal::position() const
+{
+    QMutexLocker locker(&mutex);
+    return file ? file->size() : 0;
+}
+
+void JudgingJournal::checkpoint(qint64 mark)
+{
+    QMutexLocker locker(&mutex);
+    if (! file) return;
+    
+    file->seek(qMin(mark, file->size()));
+    QByteArray tail = file->readAll();
+    QByteArray head;
+    if (runInProgress) {
+        QByteArray runData;
+        QDataStream runOut(&runData, QIODevice::WriteOnly);
+        runOut << int(RunStartedRecord) << runContestants << runTaskIndex;
+        head.append(frameRecord(runData));
+        
+        QSet< QPair<QString, int> >::const_iterator i;
+        for (i = finishedTasks.constBegin(); i != finishedTasks.constEnd(); ++ i) {
+            QByteArray data;
+            QDataStream out(&data, QIODevice::WriteOnly);
+            out << int(TaskMarkedRecord) << i->first << i->second;
+            head.append(frameRecord(data));
+        }
+        
+        QMap< QPair<QString, int>, QMap< QPair<int, int>, JudgingJobResult > >::const_iterator j;
+        for (j = finishedCases.constBegin(); j != finishedCases.constEnd(); ++ j) {
+            QMap< QPair<int, int>, JudgingJobResult >::const_iterator k;
+            for (k = j.value().constBegin(); k != j.value().constEnd(); ++ k) {
+                QByteArray data;
+                QDataStream out(&data, QIODevice::WriteOnly);
+                out << int(CaseFinishedRecord) << j.key().first << j.key().second;
+                out << k.key().first << k.key().second;
+                k.value().writeToStream(out);
+                head.append(frameRecord(data));
+            }
+        }
+    }
+    
+    file->resize(0);
+    file->seek(0);
+    file->write(head);
+    file->write(tail);
+    syncFile();
+}
+
+void JudgingJournal::resetState()
+{
+    runInProgress = false;
+    runContestants.clear();
+    runTaskIndex = -1;
+    finishedTasks.clear();
+    finishedCases.clear();
+}
+
+void JudgingJournal::writeRecord(const QByteArray &data)
+{
+    if (! file) return;
+    file->write(frameRecord(data));
+    syncFile();
+}
+
+void JudgingJournal::syncFile()
+{
+    file->flush();
+#ifdef Q_OS_LINUX
+    fsync(file->handle());
+#endif
+#ifdef Q_OS_WIN32
+    FlushFileBuffers((HANDLE)_get_osfhandle(file->handle()));
+#endif
+}
+
+QByteArray JudgingJournal::frameRecord(const QByteArray &data)
+{
+    QByteArray block;
+    QDataStream out(&block, QIODevice::WriteOnly);
+    out << quint32(data.size()) << qChecksum(data.data(), data.size());
+    block.append(data);
+    return block;
+}
+
+void JudgingJournal::applyRecord(const QByteArray &data, Contest *contest)
+{
+    QDataStream in(data);
+    int type;
+    in >> type;
+    
+    if (type == RunStartedRecord) {
+        resetState();
+        in >> runContestants >> runTaskIndex;
+        runInProgress = true;
+    }
+    
+    if (type == CaseFinishedRecord) {
+        QString contestantName;
+        int taskIndex, testCaseIndex, singleCaseIndex;
+        JudgingJobResult result;
+        in >> contestantName >> taskIndex >> testCaseIndex >> singleCaseIndex;
+        result.readFromStream(in);
+        finishedCases[qMakePair(contestantName, taskIndex)][qMakePair(testCaseIndex, singleCaseIndex)] = result;
+    }
+    
+    if (type == TaskFinishedRecord) {
+        QString contestantName, problemTitle, sourceFile, compileMessage;
+        int taskIndex, compileState;
+        QByteArray compileMessageBlob;
+        ResultTable table;
+        in >> contestantName >> taskIndex >> problemTitle;
+        in >> compileState >> sourceFile >> compileMessage >> compileMessageBlob;
+        table.readFromStream(in, true);
+        if (in.status() != QDataStream::Ok) return;
+        
+        Contestant *contestant = contest->getContestant(contestantName);
+        if (! contestant || taskIndex < 0 || taskIndex >= contest->getTaskList().size()) return;
+        Task *task = contest->getTask(taskIndex);
+        if (task->getProblemTile() != problemTitle) return;
+        int count = table.getTestCaseCount();
+        if (count > 0 && count != task->getTestCaseList().size()) return;
+        for (int i = 0; i < count; i ++) {
+            if (table.getSingleCaseCount(i) != task->getTestCase(i)->getInputFiles().size()) return;
+        }
+        
+        contestant->setCompileState(taskIndex, CompileState(compileState));
+        contestant->setSourceFile(taskIndex, sourceFile);
+        contestant->setCompileMessage(taskIndex, compileMessage, compileMessageBlob);
+        contestant->setResultTable(taskIndex, table);
+        contestant->setCheckJudged(taskIndex, true);
+        
+        QPair<QString, int> key = qMakePair(contestantName, taskIndex);
+        finishedCases.remove(key);
+        finishedTasks.insert(key);
+    }
+    
+    if (type == ContestantFinishedRecord) {
+        QString contestantName;
+        QDateTime judgingTime;
+        in >> contestantName >> judgingTime;
+        Contestant *contestant = contest->getContestant(contestantName);
+        if (contestant) contestant->setJudgingTime(judgingTime);
+    }
+    
+    if (type == TaskMarkedRecord) {
+        QString contestantName;
+        int taskIndex;
+        in >> contestantName >> taskIndex;
+        QPair<QString, int> key = qMakePair(contestantName, taskIndex);
+        finishedCases.remove(key);
+        finishedTasks.insert(key);
+    }
+    
+    if (type == RunFinishedRecord) {
+        resetState();
+    }
+}
@@ -0,0 +1,70 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#ifndef JUDGINGJOURNAL_H
+#define JUDGINGJOURNAL_H
+
+#include <QtCore>
+#include <QObject>
+#include "judgingjob.h"
+
+class Contest;
+class Contestant;
+
+class JudgingJournal : public QObject
+{
+    Q_OBJECT
+public:
+    explicit JudgingJournal(QObject *parent = 0);
+    ~JudgingJournal();
+    bool open(const QString&, Contest*);
+    void close();
+    void clear();
+    bool isOpen() const;
+    bool hasUnfinishedRun() const;
+    QStringList getRunContestants() const;
+    int getRunTaskIndex() const;
+    bool isTaskFinished(const QString&, int) const;
+    QMap< QPair<int, int>, JudgingJobResult > getFinishedCases(const QString&, int) const;
+    void runStarted(const QStringList&, int);
+    void caseFinished(const QString&, int, int, int, const JudgingJobResult&);
+    void taskFinished(Contestant*, int, const QString&);
+    void contestantFinished(Contestant*);
+    void runFinished();
+    qint64 position() const;
+    void checkpoint(qint64);
+    static QString journalFileName(const QString&);
+
+private:
+    enum RecordType { RunStartedRecord, CaseFinishedRecord, TaskFinishedRecord,
+                      ContestantFinishedRecord, RunFinishedRecord, TaskMarkedRecord };
+    QFile *file;
+    mutable QMutex mutex;
+    bool runInProgress;
+    QStringList runContestants;
+    int runTaskIndex;
+    QSet< QPair<QString, int> > finishedTasks;
+    QMap< QPair<QString, int>, QMap< QPair<int, int>, JudgingJobResult > > finishedCases;
+    void resetState();
+    void writeRecord(const QByteArray&);
+    void syncFile();
+    static QByteArray frameRecord(const QByteArray&);
+    void applyRecord(const QByteArray&, Contest*);
+};
+
+#endif // JUDGINGJOURNAL_H
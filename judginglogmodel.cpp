@@ -0,0 +1,83 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "judginglogmodel.h"
+
+static const int maxLogEntries = 5000;
+
+JudgingLogEntry::JudgingLogEntry()
+{
+    level = 0;
+    color = QColor(Qt::black);
+    bold = false;
+    result = -1;
+}
+
+JudgingLogModel::JudgingLogModel(QObject *parent) :
+    QAbstractListModel(parent)
+{
+}
+
+int JudgingLogModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) return 0;
+    return entries.size();
+}
+
+QVariant JudgingLogModel::data(const QModelIndex &index, int role) const
+{
+    if (! index.isValid() || index.row() >= entries.size()) return QVariant();
+    const JudgingLogEntry &entry = entries[index.row()];
+    if (role == Qt::DisplayRole) return QString(entry.level * 4, ' ') + entry.text;
+    if (role == Qt::ForegroundRole) return QBrush(entry.color);
+    if (role == Qt::FontRole) {
+        QFont font;
+        font.setPointSize(entry.bold ? 10 : 9);
+        font.setBold(entry.bold);
+        return font;
+    }
+    return QVariant();
+}
+
+void JudgingLogModel::appendEntries(const QList<JudgingLogEntry> &list)
+{
+    QList<JudgingLogEntry> newEntries = list;
+    if (newEntries.size() > maxLogEntries) {
+        newEntries = newEntries.mid(newEntries.size() - maxLogEntries);
+    }
+    if (newEntries.isEmpty()) return;
+    
+    int overflow = qMin(entries.size() + newEntries.size() - maxLogEntries, entries.size());
+    if (overflow > 0) {
+        beginRemoveRows(QModelIndex(), 0, overflow - 1);
+        for (int i = 0; i < overflow; i ++) {
+            entries.removeFirst();
+        }
+        endRemoveRows();
+    }
+    
+    beginInsertRows(QModelIndex(), entries.size(), entries.size() + newEntries.size() - 1);
+    entries += newEntries;
+    endInsertRows();
+}
+
+void JudgingLogModel::clear()
+{
+    beginResetModel();
+    entries.clear();
+    endResetModel();
+}
@@ -0,0 +1,49 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef JUDGINGLOGMODEL_H
+#define JUDGINGLOGMODEL_H
+
+#include <QtCore>
+#include <QtGui>
+#include <QAbstractListModel>
+
+struct JudgingLogEntry
+{
+    JudgingLogEntry();
+    QString text;
+    int level;
+    QColor color;
+    bool bold;
+    int result;
+};
+
+class JudgingLogModel : public QAbstractListModel
+{
+    Q_OBJECT
+public:
+    explicit JudgingLogModel(QObject *parent = 0);
+    int rowCount(const QModelIndex& = QModelIndex()) const;
+    QVariant data(const QModelIndex&, int) const;
+    void appendEntries(const QList<JudgingLogEntry>&);
+    void clear();
+
+private:
+    QList<JudgingLogEntry> entries;
+};
+
+#endif // JUDGINGLOGMODEL_H
@@ -0,0 +1,157 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include "judgingworker.h"
+#include "judgingjob.h"
+#include "judgingthread.h"
+#include "judgingcache.h"
+#include "task.h"
+#include <QLocalSocket>
+#ifdef Q_OS_LINUX
+#include <sched.h>
+#endif
+
+static const int maxCachedTasks = 64;
+
+JudgingWorker::JudgingWorker(QObject *parent) :
+    QObject(parent)
+{
+    socket = new QLocalSocket(this);
+    judgingCache = new JudgingCache(this);
+    connect(socket, SIGNAL(readyRead()), this, SLOT(readyRead()));
+    connect(socket, SIGNAL(disconnected()), this, SLOT(disconnected()));
+}
+
+bool JudgingWorker::connectToServer(const QString &serverName, int index)
+{
+    socket->connectToServer(serverName);
+    if (! socket->waitForConnected(30000)) return false;
+    JudgingJob::writeMessage(socket, JudgingJob::HelloMessage, index, QByteArray());
+    return true;
+}
+
+bool JudgingWorker::bindToNode(int node)
+{
+#ifdef Q_OS_LINUX
+    QFile file(QString("/sys/devices/system/node/node%1/cpulist").arg(node));
+    if (! file.open(QFile::ReadOnly)) return false;
+    QStringList ranges = QString(file.readAll()).trimmed().split(',', QString::SkipEmptyParts);
+    file.close();
+    
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    int count = 0;
+    for (int i = 0; i < ranges.size(); i ++) {
+        QStringList bounds = ranges[i].split('-');
+        int low = bounds[0].toInt();
+        int high = bounds.size() > 1 ? bounds[1].toInt() : low;
+        for (int cpu = low; cpu <= high && cpu < CPU_SETSIZE; cpu ++) {
+            CPU_SET(cpu, &mask);
+            count ++;
+        }
+    }
+    if (count == 0) return false;
+    return sched_setaffinity(0, sizeof(mask), &mask) == 0;
+#else
+    Q_UNUSED(node);
+    return false;
+#endif
+}
+
+Task* JudgingWorker::getTask(const QByteArray &data)
+{
+    QByteArray key = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+    if (taskCache.contains(key)) return taskCache[key];
+    
+    if (taskCache.size() >= maxCachedTasks && running.isEmpty()) {
+        qDeleteAll(taskCache);
+        taskCache.clear();
+    }
+    Task *task = new Task(this);
+    QDataStream in(data);
+    task->readFromStream(in);
+    taskCache[key] = task;
+    return task;
+}
+
+void JudgingWorker::startJob(qint64 id, const QByteArray &data)
+{
+    JudgingJob job;
+    QDataStream in(data);
+    job.readFromStream(in);
+    
+    if (QDir::currentPath() != job.contestPath) {
+        QDir::setCurrent(job.contestPath);
+    }
+    
+    JudgingThread *thread = new JudgingThread();
+    job.setUpThread(thread);
+    thread->setTask(getTask(job.taskData));
+    thread->setJudgingCache(judgingCache);
+    connect(thread, SIGNAL(finished()), this, SLOT(threadFinished()));
+    running[thread] = id;
+    thread->start();
+}
+
+void JudgingWorker::cancelJob(qint64 id)
+{
+    QList<JudgingThread*> threads = running.keys(id);
+    for (int i = 0; i < threads.size(); i ++) {
+        QMetaObject::invokeMethod(threads[i], "stopJudgingSlot", Qt::QueuedConnection);
+    }
+}
+
+void JudgingWorker::readyRead()
+{
+    buffer.append(socket->readAll());
+    
+    JudgingJob::MessageType type;
+    qint64 id;
+    QByteArray payload;
+    while (JudgingJob::readMessage(buffer, type, id, payload)) {
+        if (type == JudgingJob::JobMessage) startJob(id, payload);
+        if (type == JudgingJob::CancelMessage) cancelJob(id);
+    }
+}
+
+void JudgingWorker::disconnected()
+{
+    QList<JudgingThread*> threads = running.keys();
+    for (int i = 0; i < threads.size(); i ++) {
+        QMetaObject::invokeMethod(threads[i], "stopJudgingSlot", Qt::QueuedConnection);
+        threads[i]->wait();
+    }
+    QCoreApplication::exit(0);
+}
+
+void JudgingWorker::threadFinished()
+{
+    JudgingThread *thread = dynamic_cast<JudgingThread*>(sender());
+    if (! running.contains(thread)) return;
+    qint64 id = running.take(thread);
+    
+    JudgingJobResult result;
+    result.takeFrom(thread);
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    result.writeToStream(out);
+    if (socket->state() == QLocalSocket::ConnectedState) {
+        JudgingJob::writeMessage(socket, JudgingJob::ResultMessage, id, data);
+    }
+    delete thread;
+}
@@ -0,0 +1,54 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#ifndef JUDGINGWORKER_H
+#define JUDGINGWORKER_H
+
+#include <QtCore>
+#include <QObject>
+
+class QLocalSocket;
+class Task;
+class JudgingThread;
+class JudgingCache;
+
+class JudgingWorker : public QObject
+{
+    Q_OBJECT
+public:
+    explicit JudgingWorker(QObject *parent = 0);
+    bool connectToServer(const QString&, int);
+    static bool bindToNode(int);
+
+private:
+    QLocalSocket *socket;
+    QByteArray buffer;
+    JudgingCache *judgingCache;
+    QMap<QByteArray, Task*> taskCache;
+    QMap<JudgingThread*, qint64> running;
+    Task* getTask(const QByteArray&);
+    void startJob(qint64, const QByteArray&);
+    void cancelJob(qint64);
+
+private slots:
+    void readyRead();
+    void disconnected();
+    void threadFinished();
+};
+
+#endif // JUDGINGWORKER_H
@@ -0,0 +1,90 @@
+#
+#    Project Lemon - A tiny judging environment for OI contest
+#    Copyright (C) 2011 Zhipeng Jia
+#
+#    This program is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    This program is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU General Public License for more details.
+#
+#    You should have received a copy of the GNU General Public License
+#    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+QT       += core network
+QT       -= gui
+
+TARGET = lemon-cli
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += LEMON_NO_GUI
+
+MAKEFILE = Makefile.cli
+OBJECTS_DIR = build-cli
+MOC_DIR = build-cli
+RCC_DIR = build-cli
+
+SOURCES += climain.cpp \
+    lemoncli.cpp \
+    contest.cpp \
+    contestantindex.cpp \
+    ranklist.cpp \
+    task.cpp \
+    testcase.cpp \
+    settings.cpp \
+    compiler.cpp \
+    contestant.cpp \
+    resulttable.cpp \
+    messagepool.cpp \
+    judgingthread.cpp \
+    assignmentthread.cpp \
+    exportutil.cpp \
+    xlsxwriter.cpp \
+    judgingcache.cpp \
+    datacatalog.cpp \
+    datastager.cpp \
+    gziputil.cpp \
+    datagenerator.cpp \
+    contestfile.cpp \
+    judgingjob.cpp \
+    workerpool.cpp \
+    judgingjournal.cpp
+
+HEADERS  += lemoncli.h \
+    contest.h \
+    contestantindex.h \
+    ranklist.h \
+    task.h \
+    testcase.h \
+    settings.h \
+    compiler.h \
+    contestant.h \
+    resulttable.h \
+    messagepool.h \
+    judgingthread.h \
+    assignmentthread.h \
+    globaltype.h \
+    exportutil.h \
+    xlsxwriter.h \
+    judgingcache.h \
+    datacatalog.h \
+    filehashsource.h \
+    datastager.h \
+    gziputil.h \
+    datagenerator.h \
+    contestfile.h \
+    judgingjob.h \
+    workerpool.h \
+    judgingjournal.h
+
+win32:LIBS += -lpsapi
+LIBS += -lz
+
+RESOURCES += resource.qrc
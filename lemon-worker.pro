@@ -0,0 +1,57 @@
+#
+#    Project Lemon - A tiny judging environment for OI contest
+#    Copyright (C) 2011 Zhipeng Jia
+#
+#    This program is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    This program is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU General Public License for more details.
+#
+#    You should have received a copy of the GNU General Public License
+#    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+QT       += core network
+QT       -= gui
+
+TARGET = lemon-worker
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += LEMON_NO_GUI
+
+MAKEFILE = Makefile.worker
+OBJECTS_DIR = build-worker
+MOC_DIR = build-worker
+RCC_DIR = build-worker
+
+SOURCES += workermain.cpp \
+    judgingworker.cpp \
+    judgingjob.cpp \
+    judgingthread.cpp \
+    judgingcache.cpp \
+    task.cpp \
+    testcase.cpp \
+    settings.cpp \
+    compiler.cpp
+
+HEADERS  += judgingworker.h \
+    judgingjob.h \
+    judgingthread.h \
+    judgingcache.h \
+    filehashsource.h \
+    task.h \
+    testcase.h \
+    settings.h \
+    compiler.h \
+    globaltype.h
+
+win32:LIBS += -lpsapi
+
+RESOURCES += resource.qrc
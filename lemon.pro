@@ -24,6 +24,9 @@ TEMPLATE = app
 SOURCES += main.cpp \
     lemon.cpp \
     contest.cpp \
+    contestantindex.cpp \
+    taskdiscovery.cpp \
+    ranklist.cpp \
     task.cpp \
     testcase.cpp \
     settings.cpp \
@@ -36,10 +39,14 @@ SOURCES += main.cpp \
     compilersettings.cpp \
     addtestcaseswizard.cpp \
     contestant.cpp \
+    resulttable.cpp \
+    messagepool.cpp \
     judgingdialog.cpp \
+    judginglogmodel.cpp \
     judgingthread.cpp \
     optionsdialog.cpp \
     resultviewer.cpp \
+    resultviewermodel.cpp \
     assignmentthread.cpp \
     detaildialog.cpp \
     newcontestwidget.cpp \
@@ -57,13 +64,28 @@ SOURCES += main.cpp \
     editvariabledialog.cpp \
     addcompilerwizard.cpp \
     selftestutil.cpp \
-    exportutil.cpp
+    exportutil.cpp \
+    xlsxwriter.cpp \
+    judgingcache.cpp \
+    datacatalog.cpp \
+    datastager.cpp \
+    gziputil.cpp \
+    datagenerator.cpp \
+    contestfile.cpp \
+    judgingjob.cpp \
+    workerpool.cpp \
+    judgingjournal.cpp \
+    savethread.cpp \
+    datawatcher.cpp
 
 win32:SOURCES += qtlockedfile/qtlockedfile_win.cpp
 unix:SOURCES += qtlockedfile/qtlockedfile_unix.cpp
 
 HEADERS  += lemon.h \
     contest.h \
+    contestantindex.h \
+    taskdiscovery.h \
+    ranklist.h \
     task.h \
     testcase.h \
     settings.h \
@@ -76,10 +98,14 @@ HEADERS  += lemon.h \
     compilersettings.h \
     addtestcaseswizard.h \
     contestant.h \
+    resulttable.h \
+    messagepool.h \
     judgingdialog.h \
+    judginglogmodel.h \
     judgingthread.h \
     optionsdialog.h \
     resultviewer.h \
+    resultviewermodel.h \
     assignmentthread.h \
     globaltype.h \
     detaildialog.h \
@@ -98,7 +124,20 @@ HEADERS  += lemon.h \
     editvariabledialog.h \
     addcompilerwizard.h \
     selftestutil.h \
-    exportutil.h
+    exportutil.h \
+    xlsxwriter.h \
+    judgingcache.h \
+    datacatalog.h \
+    filehashsource.h \
+    datastager.h \
+    gziputil.h \
+    datagenerator.h \
+    contestfile.h \
+    judgingjob.h \
+    workerpool.h \
+    judgingjournal.h \
+    savethread.h \
+    datawatcher.h
 
 win32:FORMS += forms_win32/lemon.ui \
     forms_win32/taskeditwidget.ui \
@@ -145,6 +184,7 @@ TRANSLATIONS += lemon_zh_CN.ts
 win32:RC_FILE = lemon.rc
 
 win32:LIBS += -lpsapi
+LIBS += -lz
 
 win32:CONFIG += qaxcontainer
 
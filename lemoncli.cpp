@@ -0,0 +1,363 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include <cstdio>
+#include "lemoncli.h"
+#include "contest.h"
+#include "contestant.h"
+#include "settings.h"
+#include "contestfile.h"
+#include "exportutil.h"
+#include "judgingjournal.h"
+#include "datacatalog.h"
+
+LemonCli::LemonCli(QObject *parent) :
+    QObject(parent),
+    out(stdout),
+    err(stderr)
+{
+    settings = new Settings(this);
+    curContest = 0;
+    numberOfThreads = 0;
+    numberOfWorkerProcesses = -1;
+    refreshContestants = false;
+    saveResults = true;
+    resumeJudging = false;
+    jsonOutput = false;
+    tieBreakByTime = false;
+}
+
+int LemonCli::exec(const QStringList &arguments)
+{
+    if (! parseArguments(arguments)) {
+        printUsage();
+        return 1;
+    }
+    
+    if (! exportFile.isEmpty()) {
+        QString suffix = QFileInfo(exportFile).suffix();
+        if (suffix != "html" && suffix != "csv" && suffix != "xlsx" && suffix != "jsonl" && suffix != "lrc") {
+            err << tr("Unsupported export format: %1").arg(exportFile) << endl;
+            return 1;
+        }
+        exportFile = QFileInfo(exportFile).absoluteFilePath();
+    }
+    
+    settings->loadSettings();
+    if (numberOfThreads > 0) settings->setNumberOfThreads(numberOfThreads);
+    if (numberOfWorkerProcesses >= 0) settings->setNumberOfWorkerProcesses(numberOfWorkerProcesses);
+    if (tieBreakByTime) settings->setTieBreakByTime(true);
+    
+    QString filePath = QFileInfo(contestFile).absoluteFilePath();
+    curContest = new Contest(this);
+    curContest->setSettings(settings);
+    ContestFile::Status status = ContestFile::load(curContest, filePath);
+    if (status == ContestFile::CannotOpenFile) {
+        err << tr("Cannot open file %1").arg(contestFile) << endl;
+        return 1;
+    }
+    if (status == ContestFile::BrokenFile) {
+        err << tr("File %1 is broken").arg(contestFile) << endl;
+        return 1;
+    }
+    for (int i = 0; i < taskTieBreak.size(); i ++) {
+        if (taskTieBreak[i] >= curContest->getTaskList().size()) {
+            err << tr("No task numbered %1").arg(taskTieBreak[i] + 1) << endl;
+            return 1;
+        }
+    }
+    curContest->setTaskTieBreak(taskTieBreak);
+    
+    JudgingJournal *journal = curContest->getJudgingJournal();
+    journal->open(JudgingJournal::journalFileName(filePath), curContest);
+    
+    QDir::setCurrent(QFileInfo(filePath).path());
+    DataCatalog *catalog = curContest->getDataCatalog();
+    catalog->open(DataCatalog::catalogFileName(filePath), Settings::dataPath());
+    if (refreshContestants) curContest->refreshContestantList();
+    
+    for (int i = 0; i < selectedContestants.size(); i ++) {
+        if (! curContest->getContestant(selectedContestants[i])) {
+            err << tr("No contestant named %1").arg(selectedContestants[i]) << endl;
+            return 1;
+        }
+    }
+    
+    connect(curContest, SIGNAL(singleCaseFinished(int, int, int, int)),
+            this, SLOT(singleCaseFinished(int, int, int, int)));
+    connect(curContest, SIGNAL(taskJudgingStarted(QString)),
+            this, SLOT(taskJudgingStarted(QString)));
+    connect(curContest, SIGNAL(contestantJudgingStart(QString)),
+            this, SLOT(contestantJudgingStart(QString)));
+    connect(curContest, SIGNAL(contestantJudgingFinished()),
+            this, SLOT(contestantJudgingFinished()));
+    connect(curContest, SIGNAL(compileError(int, int)),
+            this, SLOT(compileError(int, int)));
+    
+    if (resumeJudging && journal->hasUnfinishedRun()) {
+        curContest->resumeJudging();
+    } else if (selectedContestants.isEmpty()) {
+        curContest->judgeAll();
+    } else {
+        curContest->judge(selectedContestants);
+    }
+    
+    catalog->close();
+    
+    int exitCode = 0;
+    if (saveResults) {
+        if (ContestFile::save(curContest, filePath) != ContestFile::Succeeded) {
+            err << tr("Cannot open file %1").arg(contestFile) << endl;
+            exitCode = 2;
+        } else {
+            journal->clear();
+        }
+    }
+    if (! exportFile.isEmpty()) {
+        if (! ExportUtil::exportToFile(curContest, exportFile)) {
+            err << tr("Cannot open file %1").arg(exportFile) << endl;
+            exitCode = 2;
+        }
+    }
+    
+    if (jsonOutput) {
+        printEvent("finished", QStringList() << QString("\"exitCode\":%1").arg(exitCode));
+    } else {
+        out << tr("Judging finished") << endl;
+    }
+    return exitCode;
+}
+
+bool LemonCli::parseArguments(const QStringList &arguments)
+{
+    for (int i = 0; i < arguments.size(); i ++) {
+        const QString &arg = arguments[i];
+        if (arg == "-h" || arg == "--help") return false;
+        if (arg == "-a" || arg == "--all") {
+            selectedContestants.clear();
+        } else if (arg == "-c" || arg == "--contestant") {
+            if (i + 1 >= arguments.size()) return false;
+            selectedContestants.append(arguments[++ i]);
+        } else if (arg == "-j" || arg == "--threads") {
+            if (i + 1 >= arguments.size()) return false;
+            bool ok;
+            numberOfThreads = arguments[++ i].toInt(&ok);
+            if (! ok || numberOfThreads <= 0) return false;
+        } else if (arg == "-w" || arg == "--workers") {
+            if (i + 1 >= arguments.size()) return false;
+            bool ok;
+            numberOfWorkerProcesses = arguments[++ i].toInt(&ok);
+            if (! ok || numberOfWorkerProcesses < 0) return false;
+        } else if (arg == "-e" || arg == "--export") {
+            if (i + 1 >= arguments.size()) return false;
+            exportFile = arguments[++ i];
+        } else if (arg == "-f" || arg == "--format") {
+            if (i + 1 >= arguments.size()) return false;
+            QString format = arguments[++ i];
+            if (format == "json") {
+                jsonOutput = true;
+            } else if (format == "text") {
+                jsonOutput = false;
+            } else {
+                return false;
+            }
+        } else if (arg == "-r" || arg == "--refresh") {
+            refreshContestants = true;
+        } else if (arg == "-n" || arg == "--no-save") {
+            saveResults = false;
+        } else if (arg == "-R" || arg == "--resume") {
+            resumeJudging = true;
+        } else if (arg == "-t" || arg == "--tie-break-time") {
+            tieBreakByTime = true;
+        } else if (arg == "-T" || arg == "--tie-break-tasks") {
+            if (i + 1 >= arguments.size()) return false;
+            QStringList list = arguments[++ i].split(',');
+            taskTieBreak.clear();
+            for (int j = 0; j < list.size(); j ++) {
+                bool ok;
+                int number = list[j].toInt(&ok);
+                if (! ok || number <= 0) return false;
+                taskTieBreak.append(number - 1);
+            }
+        } else if (arg.startsWith('-') || ! contestFile.isEmpty()) {
+            return false;
+        } else {
+            contestFile = arg;
+        }
+    }
+    return ! contestFile.isEmpty();
+}
+
+void LemonCli::printUsage()
+{
+    err << tr("Usage: lemon-cli [options] <contest.cdf>") << endl;
+    err << endl;
+    err << tr("  -a, --all                 judge all contestants (default)") << endl;
+    err << tr("  -c, --contestant <name>   judge only the given contestant, may be repeated") << endl;
+    err << tr("  -j, --threads <n>         number of judging threads") << endl;
+    err << tr("  -w, --workers <n>         judge in n worker processes, 0 judges in-process") << endl;
+    err << tr("  -r, --refresh             refresh the contestant list before judging") << endl;
+    err << tr("  -e, --export <file>       export results to an .html, .csv, .xlsx, .jsonl or .lrc file") << endl;
+    err << tr("  -f, --format <text|json>  progress output format, json prints one object per line") << endl;
+    err << tr("  -n, --no-save             do not write results back to the contest file") << endl;
+    err << tr("  -R, --resume              continue an interrupted run from its journal") << endl;
+    err << tr("  -t, --tie-break-time      rank equal scores by total used time") << endl;
+    err << tr("  -T, --tie-break-tasks <l> then rank by the scores of tasks l, e.g. 3,1") << endl;
+    err << tr("  -h, --help                show this message") << endl;
+}
+
+void LemonCli::printEvent(const QString &event, const QStringList &fields)
+{
+    QStringList list;
+    list << QString("\"event\":%1").arg(jsonString(event));
+    list << fields;
+    out << "{" << list.join(",") << "}" << endl;
+}
+
+QString LemonCli::jsonString(const QString &str)
+{
+    QString result = "\"";
+    for (int i = 0; i < str.length(); i ++) {
+        QChar ch = str[i];
+        if (ch == '"') {
+            result += "\\\"";
+        } else if (ch == '\\') {
+            result += "\\\\";
+        } else if (ch == '\n') {
+            result += "\\n";
+        } else if (ch == '\r') {
+            result += "\\r";
+        } else if (ch == '\t') {
+            result += "\\t";
+        } else if (ch.unicode() < 0x20) {
+            result += QString("\\u%1").arg(ch.unicode(), 4, 16, QChar('0'));
+        } else {
+            result += ch;
+        }
+    }
+    result += "\"";
+    return result;
+}
+
+QString LemonCli::resultName(ResultState result)
+{
+    switch (result) {
+        case CorrectAnswer:
+            return "CorrectAnswer";
+        case WrongAnswer:
+            return "WrongAnswer";
+        case PartlyCorrect:
+            return "PartlyCorrect";
+        case TimeLimitExceeded:
+            return "TimeLimitExceeded";
+        case MemoryLimitExceeded:
+            return "MemoryLimitExceeded";
+        case CannotStartProgram:
+            return "CannotStartProgram";
+        case FileError:
+            return "FileError";
+        case RunTimeError:
+            return "RunTimeError";
+        case InvalidSpecialJudge:
+            return "InvalidSpecialJudge";
+        case SpecialJudgeTimeLimitExceeded:
+            return "SpecialJudgeTimeLimitExceeded";
+        case SpecialJudgeRunTimeError:
+            return "SpecialJudgeRunTimeError";
+    }
+    return "";
+}
+
+QString LemonCli::compileStateName(CompileState state)
+{
+    switch (state) {
+        case CompileSuccessfully:
+            return "CompileSuccessfully";
+        case NoValidSourceFile:
+            return "NoValidSourceFile";
+        case CompileError:
+            return "CompileError";
+        case CompileTimeLimitExceeded:
+            return "CompileTimeLimitExceeded";
+        case InvalidCompiler:
+            return "InvalidCompiler";
+    }
+    return "";
+}
+
+void LemonCli::singleCaseFinished(int, int x, int y, int result)
+{
+    if (jsonOutput) {
+        printEvent("caseFinished", QStringList()
+                   << QString("\"contestant\":%1").arg(jsonString(curContestant))
+                   << QString("\"task\":%1").arg(jsonString(curTask))
+                   << QString("\"testCase\":%1").arg(x + 1)
+                   << QString("\"singleCase\":%1").arg(y + 1)
+                   << QString("\"result\":%1").arg(jsonString(resultName(ResultState(result)))));
+    } else {
+        out << "    " << tr("Test case %1.%2: %3").arg(x + 1).arg(y + 1).arg(resultName(ResultState(result))) << endl;
+    }
+}
+
+void LemonCli::taskJudgingStarted(const QString &taskName)
+{
+    curTask = taskName;
+    if (jsonOutput) {
+        printEvent("taskStarted", QStringList()
+                   << QString("\"contestant\":%1").arg(jsonString(curContestant))
+                   << QString("\"task\":%1").arg(jsonString(curTask)));
+    } else {
+        out << "  " << tr("Start judging task %1").arg(taskName) << endl;
+    }
+}
+
+void LemonCli::contestantJudgingStart(const QString &contestantName)
+{
+    curContestant = contestantName;
+    if (jsonOutput) {
+        printEvent("contestantStarted", QStringList()
+                   << QString("\"contestant\":%1").arg(jsonString(curContestant)));
+    } else {
+        out << tr("Start judging contestant %1").arg(contestantName) << endl;
+    }
+}
+
+void LemonCli::contestantJudgingFinished()
+{
+    Contestant *contestant = curContest->getContestant(curContestant);
+    int totalScore = contestant ? contestant->getTotalScore() : -1;
+    if (jsonOutput) {
+        printEvent("contestantFinished", QStringList()
+                   << QString("\"contestant\":%1").arg(jsonString(curContestant))
+                   << QString("\"totalScore\":%1").arg(totalScore));
+    } else {
+        out << "  " << tr("Total score: %1").arg(totalScore) << endl;
+    }
+}
+
+void LemonCli::compileError(int, int compileState)
+{
+    if (jsonOutput) {
+        printEvent("compileError", QStringList()
+                   << QString("\"contestant\":%1").arg(jsonString(curContestant))
+                   << QString("\"task\":%1").arg(jsonString(curTask))
+                   << QString("\"state\":%1").arg(jsonString(compileStateName(CompileState(compileState)))));
+    } else {
+        out << "    " << compileStateName(CompileState(compileState)) << endl;
+    }
+}
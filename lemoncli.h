@@ -0,0 +1,69 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#ifndef LEMONCLI_H
+#define LEMONCLI_H
+
+#include <QtCore>
+#include <QObject>
+#include "globaltype.h"
+
+class Contest;
+class Settings;
+
+class LemonCli : public QObject
+{
+    Q_OBJECT
+public:
+    explicit LemonCli(QObject *parent = 0);
+    int exec(const QStringList&);
+
+private:
+    Settings *settings;
+    Contest *curContest;
+    QTextStream out;
+    QTextStream err;
+    QString contestFile;
+    QStringList selectedContestants;
+    QString exportFile;
+    int numberOfThreads;
+    int numberOfWorkerProcesses;
+    bool refreshContestants;
+    bool saveResults;
+    bool resumeJudging;
+    bool jsonOutput;
+    bool tieBreakByTime;
+    QList<int> taskTieBreak;
+    QString curContestant;
+    QString curTask;
+    bool parseArguments(const QStringList&);
+    void printUsage();
+    void printEvent(const QString&, const QStringList&);
+    static QString jsonString(const QString&);
+    static QString resultName(ResultState);
+    static QString compileStateName(CompileState);
+
+private slots:
+    void singleCaseFinished(int, int, int, int);
+    void taskJudgingStarted(const QString&);
+    void contestantJudgingStart(const QString&);
+    void contestantJudgingFinished();
+    void compileError(int, int);
+};
+
+#endif // LEMONCLI_H
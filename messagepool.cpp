@@ -0,0 +1,79 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "messagepool.h"
+#include "settings.h"
+
+static const int maxPoolSize = 65536;
+
+QMutex MessagePool::mutex;
+QSet<QString> MessagePool::pool;
+
+QString MessagePool::intern(const QString &message)
+{
+    if (message.isEmpty()) return message;
+    QMutexLocker locker(&mutex);
+    QSet<QString>::const_iterator iter = pool.constFind(message);
+    if (iter != pool.constEnd()) return *iter;
+    if (pool.size() < maxPoolSize) pool.insert(message);
+    return message;
+}
+
+// Messages over the limit are truncated; the full text goes to
+// message/<sha1>.txt in the contest directory and blob receives the hash.
+QString MessagePool::cap(const QString &message, int limit, QByteArray &blob)
+{
+    blob.clear();
+    QByteArray data = message.toUtf8();
+    if (limit <= 0 || data.size() <= limit) return message;
+    
+    QByteArray hash = QCryptographicHash::hash(data, QCryptographicHash::Sha1).toHex();
+    QString fileName = Settings::messagePath() + QString(hash) + ".txt";
+    if (! QFile::exists(fileName)) {
+        QDir().mkpath(Settings::messagePath());
+        QFile file(fileName + ".tmp");
+        if (file.open(QFile::WriteOnly)) {
+            file.write(data);
+            file.close();
+            QFile::rename(fileName + ".tmp", fileName);
+        }
+    }
+    if (QFile::exists(fileName)) blob = hash;
+    
+    int length = limit;
+    while (length > 0 && (uchar(data[length]) & 0xC0) == 0x80) length --;
+    return QString::fromUtf8(data.constData(), length)
+           + QString("\n... (%1 bytes truncated)").arg(data.size() - length);
+}
+
+QString MessagePool::expand(const QString &message, const QByteArray &blob, const QString &contestPath)
+{
+    if (blob.size() != 40) return message;
+    for (int i = 0; i < blob.size(); i ++) {
+        char ch = blob[i];
+        if ((ch < '0' || ch > '9') && (ch < 'a' || ch > 'f')) return message;
+    }
+    QFile file(QDir(contestPath).absoluteFilePath(Settings::messagePath() + QString(blob) + ".txt"));
+    if (! file.open(QFile::ReadOnly)) return message;
+    return QString::fromUtf8(file.readAll().data());
+}
+
+void MessagePool::clear()
+{
+    QMutexLocker locker(&mutex);
+    pool.clear();
+}
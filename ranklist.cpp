@@ -0,0 +1,103 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "ranklist.h"
+#include "contestant.h"
+
+RankList::RankList()
+{
+    tieBreak = NoTieBreak;
+}
+
+RankList::TieBreak RankList::getTieBreak() const
+{
+    return tieBreak;
+}
+
+void RankList::setTieBreak(TieBreak _tieBreak)
+{
+    tieBreak = _tieBreak;
+}
+
+void RankList::setTaskTieBreak(const QList<int> &taskList)
+{
+    taskTieBreak = taskList;
+}
+
+void RankList::build(const QList<Contestant*> &contestantList)
+{
+    entries.clear();
+    position.clear();
+    
+    for (int i = 0; i < contestantList.size(); i ++) {
+        Contestant *contestant = contestantList[i];
+        
+        Entry entry;
+        entry.contestant = contestant;
+        entry.name = contestant->getContestantName();
+        int totalScore = contestant->getTotalScore();
+        entry.keys.append(totalScore != -1 ? - totalScore : 1);
+        if (tieBreak == TotalTimeUsed) {
+            entry.keys.append(totalScore != -1 ? contestant->getTotalUsedTime() : 0);
+        }
+        for (int j = 0; j < taskTieBreak.size(); j ++) {
+            entry.keys.append(- contestant->getTaskScore(taskTieBreak[j]));
+        }
+        entry.rank = 0;
+        entries.append(entry);
+    }
+    
+    qSort(entries.begin(), entries.end(), compareEntry);
+    
+    for (int i = 0; i < entries.size(); i ++) {
+        if (i > 0 && entries[i].keys == entries[i - 1].keys) {
+            entries[i].rank = entries[i - 1].rank;
+        } else {
+            entries[i].rank = i + 1;
+        }
+        position.insert(entries[i].contestant, i);
+    }
+}
+
+int RankList::size() const
+{
+    return entries.size();
+}
+
+Contestant* RankList::contestantAt(int index) const
+{
+    return entries[index].contestant;
+}
+
+int RankList::rankAt(int index) const
+{
+    return entries[index].rank;
+}
+
+int RankList::getRank(Contestant *contestant) const
+{
+    if (! position.contains(contestant)) return -1;
+    return entries[position.value(contestant)].rank;
+}
+
+bool RankList::compareEntry(const Entry &a, const Entry &b)
+{
+    for (int i = 0; i < a.keys.size(); i ++) {
+        if (a.keys[i] != b.keys[i]) return a.keys[i] < b.keys[i];
+    }
+    return a.name < b.name;
+}
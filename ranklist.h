@@ -0,0 +1,55 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef RANKLIST_H
+#define RANKLIST_H
+
+#include <QtCore>
+
+class Contestant;
+
+class RankList
+{
+public:
+    enum TieBreak { NoTieBreak, TotalTimeUsed };
+    
+    RankList();
+    TieBreak getTieBreak() const;
+    void setTieBreak(TieBreak);
+    void setTaskTieBreak(const QList<int>&);
+    void build(const QList<Contestant*>&);
+    int size() const;
+    Contestant* contestantAt(int) const;
+    int rankAt(int) const;
+    int getRank(Contestant*) const;
+
+private:
+    struct Entry {
+        Contestant *contestant;
+        QString name;
+        QVector<int> keys;
+        int rank;
+    };
+    
+    TieBreak tieBreak;
+    QList<int> taskTieBreak;
+    QList<Entry> entries;
+    QHash<Contestant*, int> position;
+    static bool compareEntry(const Entry&, const Entry&);
+};
+
+#endif // RANKLIST_H
@@ -0,0 +1,450 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "resulttable.h"
+#include "messagepool.h"
+
+ResultTable::ResultTable()
+{
+    caseOffset.append(0);
+    totalScore = 0;
+    totalTimeUsed = 0;
+}
+
+template<typename T> void ResultTable::reshapeLike(const QList<T> &list)
+{
+    QList<int> sizes;
+    for (int i = 0; i < list.size(); i ++) {
+        sizes.append(list[i].size());
+    }
+    reshape(sizes);
+}
+
+int ResultTable::getTestCaseCount() const
+{
+    return caseOffset.size() - 1;
+}
+
+int ResultTable::getSingleCaseCount(int index) const
+{
+    return caseOffset[index + 1] - caseOffset[index];
+}
+
+int ResultTable::getCaseCount() const
+{
+    return caseOffset.last();
+}
+
+int ResultTable::getOffset(int testCaseIndex, int singleCaseIndex) const
+{
+    return caseOffset[testCaseIndex] + singleCaseIndex;
+}
+
+ResultState ResultTable::resultAt(int offset) const
+{
+    return ResultState(result[offset]);
+}
+
+int ResultTable::scoreAt(int offset) const
+{
+    return score[offset];
+}
+
+int ResultTable::timeUsedAt(int offset) const
+{
+    return timeUsed[offset];
+}
+
+qint64 ResultTable::memoryUsedAt(int offset) const
+{
+    return memoryUsed[offset];
+}
+
+QString ResultTable::messageAt(int offset) const
+{
+    int index = messageIndex[offset];
+    if (index < 0) return QString("");
+    return messagePool[index];
+}
+
+QByteArray ResultTable::messageBlobAt(int offset) const
+{
+    int index = messageIndex[offset];
+    if (index < 0) return QByteArray();
+    return messageBlobs[index];
+}
+
+const QString& ResultTable::inputFileAt(int offset) const
+{
+    return inputFiles[offset];
+}
+
+int ResultTable::getTestCaseScore(int index) const
+{
+    return testCaseScore[index];
+}
+
+int ResultTable::getTotalScore() const
+{
+    return totalScore;
+}
+
+int ResultTable::getTotalTimeUsed() const
+{
+    return totalTimeUsed;
+}
+
+QList<QStringList> ResultTable::getInputFiles() const
+{
+    QList<QStringList> list;
+    for (int i = 0; i + 1 < caseOffset.size(); i ++) {
+        list.append(inputFiles.mid(caseOffset[i], caseOffset[i + 1] - caseOffset[i]));
+    }
+    return list;
+}
+
+QList< QList<ResultState> > ResultTable::getResult() const
+{
+    QList< QList<ResultState> > list;
+    for (int i = 0; i + 1 < caseOffset.size(); i ++) {
+        list.append(QList<ResultState>());
+        for (int j = caseOffset[i]; j < caseOffset[i + 1]; j ++) {
+            list[i].append(ResultState(result[j]));
+        }
+    }
+    return list;
+}
+
+QList<QStringList> ResultTable::getMessage() const
+{
+    QList<QStringList> list;
+    for (int i = 0; i + 1 < caseOffset.size(); i ++) {
+        list.append(QStringList());
+        for (int j = caseOffset[i]; j < caseOffset[i + 1]; j ++) {
+            list[i].append(messageAt(j));
+        }
+    }
+    return list;
+}
+
+QList< QList<int> > ResultTable::getScore() const
+{
+    QList< QList<int> > list;
+    for (int i = 0; i + 1 < caseOffset.size(); i ++) {
+        list.append(score.mid(caseOffset[i], caseOffset[i + 1] - caseOffset[i]).toList());
+    }
+    return list;
+}
+
+QList< QList<int> > ResultTable::getTimeUsed() const
+{
+    QList< QList<int> > list;
+    for (int i = 0; i + 1 < caseOffset.size(); i ++) {
+        list.append(timeUsed.mid(caseOffset[i], caseOffset[i + 1] - caseOffset[i]).toList());
+    }
+    return list;
+}
+
+QList< QList<int> > ResultTable::getMemoryUsed() const
+{
+    QList< QList<int> > list;
+    for (int i = 0; i + 1 < caseOffset.size(); i ++) {
+        list.append(QList<int>());
+        for (int j = caseOffset[i]; j < caseOffset[i + 1]; j ++) {
+            list[i].append(int(memoryUsed[j]));
+        }
+    }
+    return list;
+}
+
+void ResultTable::setInputFiles(const QList<QStringList> &list)
+{
+    reshapeLike(list);
+    for (int i = 0; i < list.size(); i ++) {
+        for (int j = 0; j < list[i].size(); j ++) {
+            inputFiles[caseOffset[i] + j] = list[i][j];
+        }
+    }
+}
+
+void ResultTable::setResult(const QList< QList<ResultState> > &list)
+{
+    reshapeLike(list);
+    for (int i = 0; i < list.size(); i ++) {
+        for (int j = 0; j < list[i].size(); j ++) {
+            result[caseOffset[i] + j] = quint8(list[i][j]);
+        }
+    }
+}
+
+void ResultTable::setMessage(const QList<QStringList> &list)
+{
+    reshapeLike(list);
+    poolIndex.clear();
+    messagePool.clear();
+    messageBlobs.clear();
+    for (int i = 0; i < list.size(); i ++) {
+        for (int j = 0; j < list[i].size(); j ++) {
+            int index = -1;
+            if (! list[i][j].isEmpty()) {
+                QPair<QString, QByteArray> key(list[i][j], QByteArray());
+                index = poolIndex.value(key, -1);
+                if (index == -1) {
+                    index = messagePool.size();
+                    poolIndex.insert(key, index);
+                    messagePool.append(MessagePool::intern(list[i][j]));
+                    messageBlobs.append(QByteArray());
+                }
+            }
+            messageIndex[caseOffset[i] + j] = index;
+        }
+    }
+}
+
+void ResultTable::setScore(const QList< QList<int> > &list)
+{
+    reshapeLike(list);
+    for (int i = 0; i < list.size(); i ++) {
+        for (int j = 0; j < list[i].size(); j ++) {
+            score[caseOffset[i] + j] = list[i][j];
+        }
+    }
+    updateScoreCache();
+}
+
+void ResultTable::setTimeUsed(const QList< QList<int> > &list)
+{
+    reshapeLike(list);
+    for (int i = 0; i < list.size(); i ++) {
+        for (int j = 0; j < list[i].size(); j ++) {
+            timeUsed[caseOffset[i] + j] = list[i][j];
+        }
+    }
+    updateTimeCache();
+}
+
+void ResultTable::setMemoryUsed(const QList< QList<int> > &list)
+{
+    reshapeLike(list);
+    for (int i = 0; i < list.size(); i ++) {
+        for (int j = 0; j < list[i].size(); j ++) {
+            memoryUsed[caseOffset[i] + j] = list[i][j];
+        }
+    }
+}
+
+void ResultTable::setResultAt(int offset, ResultState value)
+{
+    result[offset] = quint8(value);
+}
+
+void ResultTable::setScoreAt(int offset, int value)
+{
+    score[offset] = value;
+    int index = qUpperBound(caseOffset.begin(), caseOffset.end(), offset) - caseOffset.begin() - 1;
+    int minv = score[offset];
+    for (int j = caseOffset[index]; j < caseOffset[index + 1]; j ++) {
+        if (score[j] < minv) minv = score[j];
+    }
+    totalScore += minv - testCaseScore[index];
+    testCaseScore[index] = minv;
+}
+
+void ResultTable::setTimeUsedAt(int offset, int value)
+{
+    if (timeUsed[offset] >= 0) totalTimeUsed -= timeUsed[offset];
+    timeUsed[offset] = value;
+    if (value >= 0) totalTimeUsed += value;
+}
+
+void ResultTable::setMemoryUsedAt(int offset, qint64 value)
+{
+    memoryUsed[offset] = value;
+}
+
+void ResultTable::setMessageAt(int offset, const QString &message, const QByteArray &blob)
+{
+    int index = -1;
+    if (! message.isEmpty()) {
+        // Rejudged cases leave replaced messages behind; drop them once they dominate
+        if (messagePool.size() > messageIndex.size() * 2) {
+            compactMessages(messageIndex, messagePool, messageBlobs);
+            poolIndex.clear();
+        }
+        if (poolIndex.isEmpty() && ! messagePool.isEmpty()) buildPoolIndex();
+        QPair<QString, QByteArray> key(message, blob);
+        index = poolIndex.value(key, -1);
+        if (index == -1) {
+            index = messagePool.size();
+            poolIndex.insert(key, index);
+            messagePool.append(MessagePool::intern(message));
+            messageBlobs.append(blob);
+        }
+    }
+    messageIndex[offset] = index;
+}
+
+void ResultTable::setInputFileAt(int offset, const QString &fileName)
+{
+    inputFiles[offset] = fileName;
+}
+
+void ResultTable::writeToStream(QDataStream &out) const
+{
+    QVector<qint32> usedIndex = messageIndex;
+    QStringList usedPool = messagePool;
+    QList<QByteArray> usedBlobs = messageBlobs;
+    compactMessages(usedIndex, usedPool, usedBlobs);
+    out << caseOffset;
+    out << result;
+    out << score;
+    out << timeUsed;
+    out << memoryUsed;
+    out << usedIndex;
+    out << usedPool;
+    out << inputFiles;
+    out << usedBlobs;
+}
+
+void ResultTable::readFromStream(QDataStream &in, bool hasBlobs)
+{
+    in >> caseOffset;
+    in >> result;
+    in >> score;
+    in >> timeUsed;
+    in >> memoryUsed;
+    in >> messageIndex;
+    in >> messagePool;
+    in >> inputFiles;
+    poolIndex.clear();
+    messageBlobs.clear();
+    if (hasBlobs) {
+        in >> messageBlobs;
+    } else {
+        for (int i = 0; i < messagePool.size(); i ++) {
+            messageBlobs.append(QByteArray());
+        }
+    }
+    for (int i = 0; i < messagePool.size(); i ++) {
+        messagePool[i] = MessagePool::intern(messagePool[i]);
+    }
+    
+    int total = caseOffset.isEmpty() ? -1 : caseOffset.last();
+    if (result.size() != total || score.size() != total || timeUsed.size() != total
+            || memoryUsed.size() != total || messageIndex.size() != total || inputFiles.size() != total
+            || messageBlobs.size() != messagePool.size()) {
+        *this = ResultTable();
+    }
+    updateScoreCache();
+    updateTimeCache();
+}
+
+void ResultTable::reshape(const QList<int> &sizes)
+{
+    bool same = sizes.size() == getTestCaseCount();
+    for (int i = 0; same && i < sizes.size(); i ++) {
+        if (sizes[i] != getSingleCaseCount(i)) same = false;
+    }
+    if (same) return;
+    
+    QVector<int> newOffset(sizes.size() + 1, 0);
+    for (int i = 0; i < sizes.size(); i ++) {
+        newOffset[i + 1] = newOffset[i] + sizes[i];
+    }
+    int total = newOffset.last();
+    QVector<quint8> newResult(total, quint8(WrongAnswer));
+    QVector<qint32> newScore(total, 0);
+    QVector<qint32> newTimeUsed(total, -1);
+    QVector<qint64> newMemoryUsed(total, -1);
+    QVector<qint32> newMessageIndex(total, -1);
+    QStringList newInputFiles;
+    for (int i = 0; i < total; i ++) {
+        newInputFiles.append("");
+    }
+    
+    for (int i = 0; i < sizes.size() && i < getTestCaseCount(); i ++) {
+        for (int j = 0; j < sizes[i] && j < getSingleCaseCount(i); j ++) {
+            int from = caseOffset[i] + j, to = newOffset[i] + j;
+            newResult[to] = result[from];
+            newScore[to] = score[from];
+            newTimeUsed[to] = timeUsed[from];
+            newMemoryUsed[to] = memoryUsed[from];
+            newMessageIndex[to] = messageIndex[from];
+            newInputFiles[to] = inputFiles[from];
+        }
+    }
+    
+    caseOffset = newOffset;
+    result = newResult;
+    score = newScore;
+    timeUsed = newTimeUsed;
+    memoryUsed = newMemoryUsed;
+    messageIndex = newMessageIndex;
+    inputFiles = newInputFiles;
+    updateScoreCache();
+    updateTimeCache();
+}
+
+void ResultTable::updateScoreCache()
+{
+    testCaseScore.resize(caseOffset.size() - 1);
+    totalScore = 0;
+    for (int i = 0; i + 1 < caseOffset.size(); i ++) {
+        int minv = 1000000000;
+        for (int j = caseOffset[i]; j < caseOffset[i + 1]; j ++) {
+            if (score[j] < minv) minv = score[j];
+        }
+        if (minv == 1000000000) minv = 0;
+        testCaseScore[i] = minv;
+        totalScore += minv;
+    }
+}
+
+void ResultTable::updateTimeCache()
+{
+    totalTimeUsed = 0;
+    for (int i = 0; i < timeUsed.size(); i ++) {
+        if (timeUsed[i] >= 0) totalTimeUsed += timeUsed[i];
+    }
+}
+
+void ResultTable::buildPoolIndex()
+{
+    poolIndex.clear();
+    for (int i = 0; i < messagePool.size(); i ++) {
+        poolIndex.insert(qMakePair(messagePool[i], messageBlobs[i]), i);
+    }
+}
+
+void ResultTable::compactMessages(QVector<qint32> &indexList, QStringList &pool, QList<QByteArray> &blobs)
+{
+    QVector<qint32> newIndex(pool.size(), -1);
+    QStringList newPool;
+    QList<QByteArray> newBlobs;
+    for (int i = 0; i < indexList.size(); i ++) {
+        int index = indexList[i];
+        if (index < 0) continue;
+        if (newIndex[index] == -1) {
+            newIndex[index] = newPool.size();
+            newPool.append(pool[index]);
+            newBlobs.append(blobs[index]);
+        }
+        indexList[i] = newIndex[index];
+    }
+    pool = newPool;
+    blobs = newBlobs;
+}
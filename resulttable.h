@@ -0,0 +1,90 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef RESULTTABLE_H
+#define RESULTTABLE_H
+
+#include <QtCore>
+#include "globaltype.h"
+
+class ResultTable
+{
+public:
+    ResultTable();
+    
+    int getTestCaseCount() const;
+    int getSingleCaseCount(int) const;
+    int getCaseCount() const;
+    int getOffset(int, int) const;
+    ResultState resultAt(int) const;
+    int scoreAt(int) const;
+    int timeUsedAt(int) const;
+    qint64 memoryUsedAt(int) const;
+    QString messageAt(int) const;
+    QByteArray messageBlobAt(int) const;
+    const QString& inputFileAt(int) const;
+    int getTestCaseScore(int) const;
+    int getTotalScore() const;
+    int getTotalTimeUsed() const;
+    
+    QList<QStringList> getInputFiles() const;
+    QList< QList<ResultState> > getResult() const;
+    QList<QStringList> getMessage() const;
+    QList< QList<int> > getScore() const;
+    QList< QList<int> > getTimeUsed() const;
+    QList< QList<int> > getMemoryUsed() const;
+    
+    void setInputFiles(const QList<QStringList>&);
+    void setResult(const QList< QList<ResultState> >&);
+    void setMessage(const QList<QStringList>&);
+    void setScore(const QList< QList<int> >&);
+    void setTimeUsed(const QList< QList<int> >&);
+    void setMemoryUsed(const QList< QList<int> >&);
+    
+    void reshape(const QList<int>&);
+    void setResultAt(int, ResultState);
+    void setScoreAt(int, int);
+    void setTimeUsedAt(int, int);
+    void setMemoryUsedAt(int, qint64);
+    void setMessageAt(int, const QString&, const QByteArray&);
+    void setInputFileAt(int, const QString&);
+    
+    void writeToStream(QDataStream&) const;
+    void readFromStream(QDataStream&, bool);
+
+private:
+    QVector<int> caseOffset;
+    QVector<quint8> result;
+    QVector<qint32> score;
+    QVector<qint32> timeUsed;
+    QVector<qint64> memoryUsed;
+    QVector<qint32> messageIndex;
+    QStringList messagePool;
+    QList<QByteArray> messageBlobs;
+    QHash<QPair<QString, QByteArray>, int> poolIndex;
+    QStringList inputFiles;
+    QVector<qint32> testCaseScore;
+    int totalScore;
+    int totalTimeUsed;
+    void updateScoreCache();
+    void updateTimeCache();
+    void buildPoolIndex();
+    static void compactMessages(QVector<qint32>&, QStringList&, QList<QByteArray>&);
+    template<typename T> void reshapeLike(const QList<T>&);
+};
+
+#endif // RESULTTABLE_H
@@ -0,0 +1,128 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "resultviewermodel.h"
+#include "contest.h"
+#include "contestant.h"
+#include "task.h"
+#include "ranklist.h"
+
+ResultViewerModel::ResultViewerModel(QObject *parent) :
+    QAbstractTableModel(parent)
+{
+    curContest = 0;
+}
+
+void ResultViewerModel::setContest(Contest *contest)
+{
+    curContest = contest;
+    refresh();
+}
+
+int ResultViewerModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) return 0;
+    return contestantList.size();
+}
+
+int ResultViewerModel::columnCount(const QModelIndex &parent) const
+{
+    if (parent.isValid() || ! curContest) return 0;
+    return taskList.size() + 5;
+}
+
+QVariant ResultViewerModel::data(const QModelIndex &index, int role) const
+{
+    if (! index.isValid() || index.row() >= contestantList.size()) return QVariant();
+    if (role == Qt::TextAlignmentRole) return int(Qt::AlignHCenter | Qt::AlignVCenter);
+    if (role != Qt::DisplayRole && role != Qt::UserRole) return QVariant();
+    
+    Contestant *contestant = contestantList[index.row()];
+    int column = index.column();
+    if (column == 0) return contestant->getContestantName();
+    
+    int value = -1;
+    if (column == 1) {
+        if (rowScore[index.row()] != -1) {
+            value = curContest->getRankList().getRank(contestant);
+        }
+    } else if (column < taskList.size() + 2) {
+        value = contestant->getTaskScore(column - 2);
+    } else {
+        value = rowScore[index.row()];
+    }
+    
+    if (value == -1) {
+        if (role == Qt::UserRole) return -1;
+        return tr("Invalid");
+    }
+    if (column == taskList.size() + 3) return double(contestant->getTotalUsedTime()) / 1000;
+    if (column == taskList.size() + 4) {
+        if (role == Qt::UserRole) return contestant->getJudingTime().toTime_t();
+        return contestant->getJudingTime();
+    }
+    return value;
+}
+
+QVariant ResultViewerModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) return QVariant();
+    if (section == 0) return tr("Name");
+    if (section == 1) return tr("Rank");
+    if (section < taskList.size() + 2) return taskList[section - 2]->getProblemTile();
+    if (section == taskList.size() + 2) return tr("Total Score");
+    if (section == taskList.size() + 3) return tr("Total Used Time (s)");
+    return tr("Judging Time");
+}
+
+Contestant* ResultViewerModel::getContestant(int row) const
+{
+    if (row < 0 || row >= contestantList.size()) return 0;
+    return contestantList[row];
+}
+
+void ResultViewerModel::refresh()
+{
+    beginResetModel();
+    taskList.clear();
+    contestantList.clear();
+    rowIndex.clear();
+    rowScore.clear();
+    if (curContest) {
+        taskList = curContest->getTaskList();
+        contestantList = curContest->getContestantList();
+        for (int i = 0; i < contestantList.size(); i ++) {
+            int score = contestantList[i]->getTotalScore();
+            rowIndex.insert(contestantList[i]->getContestantName(), i);
+            rowScore.append(score);
+        }
+    }
+    endResetModel();
+}
+
+void ResultViewerModel::refreshContestant(const QString &name)
+{
+    int row = rowIndex.value(name, -1);
+    if (row == -1) return;
+    
+    int score = contestantList[row]->getTotalScore();
+    if (score != rowScore[row]) {
+        rowScore[row] = score;
+        emit dataChanged(index(0, 1), index(contestantList.size() - 1, 1));
+    }
+    emit dataChanged(index(row, 0), index(row, columnCount() - 1));
+}
@@ -0,0 +1,53 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef RESULTVIEWERMODEL_H
+#define RESULTVIEWERMODEL_H
+
+#include <QtCore>
+#include <QtGui>
+#include <QAbstractTableModel>
+
+class Contest;
+class Contestant;
+class Task;
+
+class ResultViewerModel : public QAbstractTableModel
+{
+    Q_OBJECT
+public:
+    explicit ResultViewerModel(QObject *parent = 0);
+    void setContest(Contest*);
+    int rowCount(const QModelIndex& = QModelIndex()) const;
+    int columnCount(const QModelIndex& = QModelIndex()) const;
+    QVariant data(const QModelIndex&, int) const;
+    QVariant headerData(int, Qt::Orientation, int) const;
+    Contestant* getContestant(int) const;
+
+public slots:
+    void refresh();
+    void refreshContestant(const QString&);
+
+private:
+    Contest *curContest;
+    QList<Task*> taskList;
+    QList<Contestant*> contestantList;
+    QHash<QString, int> rowIndex;
+    QList<int> rowScore;
+};
+
+#endif // RESULTVIEWERMODEL_H
@@ -0,0 +1,40 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "savethread.h"
+
+SaveThread::SaveThread(QObject *parent) :
+    QThread(parent)
+{
+    snapshot = 0;
+    status = ContestFile::Succeeded;
+}
+
+void SaveThread::setSnapshot(ContestSnapshot *_snapshot)
+{
+    snapshot = _snapshot;
+}
+
+ContestFile::Status SaveThread::getStatus() const
+{
+    return status;
+}
+
+void SaveThread::run()
+{
+    status = ContestFile::writeSnapshot(snapshot);
+}
@@ -0,0 +1,39 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef SAVETHREAD_H
+#define SAVETHREAD_H
+
+#include <QtCore>
+#include <QThread>
+#include "contestfile.h"
+
+class SaveThread : public QThread
+{
+    Q_OBJECT
+public:
+    explicit SaveThread(QObject *parent = 0);
+    void setSnapshot(ContestSnapshot*);
+    ContestFile::Status getStatus() const;
+
+private:
+    ContestSnapshot *snapshot;
+    ContestFile::Status status;
+    void run();
+};
+
+#endif // SAVETHREAD_H
@@ -21,6 +21,8 @@
 #include "task.h"
 #include "testcase.h"
 #include "settings.h"
+#include "gziputil.h"
+#include "datagenerator.h"
 
 SelfTestUtil::SelfTestUtil(QObject *parent) :
     QObject(parent)
@@ -59,6 +61,7 @@ void SelfTestUtil::makeSelfTest(QWidget *widget, Contest *contest)
         return;
     }
     QList<Task*> taskList = contest->getTaskList();
+    DataGenerator generator;
     for (int i = 0; i < taskList.size(); i ++) {
         QDir(Settings::selfTestPath()).mkdir(taskList[i]->getProblemTile());
         QList<TestCase*> testCaseList = taskList[i]->getTestCaseList();
@@ -134,21 +137,31 @@ void SelfTestUtil::makeSelfTest(QWidget *widget, Contest *contest)
                     outputFile = taskList[i]->getSourceFileName();
                     outputFile += QString("%1.out").arg(index);
                 } else {
-                    inputFile = QFileInfo(inputFiles[k]).fileName();
-                    outputFile = QFileInfo(outputFiles[k]).fileName();
+                    inputFile = QFileInfo(DataGenerator::generatedName(Settings::dataPath() + inputFiles[k])).fileName();
+                    outputFile = QFileInfo(DataGenerator::generatedName(Settings::dataPath() + outputFiles[k])).fileName();
+                    inputFile = GzipUtil::uncompressedName(inputFile);
+                    outputFile = GzipUtil::uncompressedName(outputFile);
                 }
-                if (! QFile::copy(Settings::dataPath() + inputFiles[k],
-                                  Settings::selfTestPath() + taskList[i]->getProblemTile() + QDir::separator()
-                                  + inputFile)) {
+                QString inputFileSource = Settings::dataPath() + inputFiles[k];
+                if (DataGenerator::isGenerated(inputFileSource)) {
+                    inputFileSource = generator.materialize(inputFileSource);
+                }
+                if (! GzipUtil::copyFile(inputFileSource,
+                                         Settings::selfTestPath() + taskList[i]->getProblemTile() + QDir::separator()
+                                         + inputFile)) {
                     QApplication::restoreOverrideCursor();
                     QMessageBox::warning(widget, tr("Lemon"),
                                          tr("Cannot copy %1").arg(QFileInfo(inputFiles[k]).fileName()),
                                          QMessageBox::Ok);
                     return;
                 }
-                if (! QFile::copy(Settings::dataPath() + outputFiles[k],
-                                  Settings::selfTestPath() + taskList[i]->getProblemTile() + QDir::separator()
-                                  + outputFile)) {
+                QString outputFileSource = Settings::dataPath() + outputFiles[k];
+                if (DataGenerator::isGenerated(outputFileSource)) {
+                    outputFileSource = generator.materialize(outputFileSource);
+                }
+                if (! GzipUtil::copyFile(outputFileSource,
+                                         Settings::selfTestPath() + taskList[i]->getProblemTile() + QDir::separator()
+                                         + outputFile)) {
                     QApplication::restoreOverrideCursor();
                     QMessageBox::warning(widget, tr("Lemon"),
                                          tr("Cannot copy %1").arg(QFileInfo(outputFiles[k]).fileName()),
@@ -181,7 +194,7 @@ void SelfTestUtil::makeSelfTest(QWidget *widget, Contest *contest)
                         outputFileName = taskList[i]->getOutputFileName();
                     }
                 } else {
-                    outputFileName = QFileInfo(inputFiles[k]).completeBaseName() + "."
+                    outputFileName = QFileInfo(inputFile).completeBaseName() + "."
                                      + taskList[i]->getAnswerFileExtension();
                 }
                 if (taskList[i]->getComparisonMode() == Task::LineByLineMode) {
@@ -250,7 +263,7 @@ void SelfTestUtil::makeSelfTest(QWidget *widget, Contest *contest)
                         outputFileName = taskList[i]->getOutputFileName();
                     }
                 } else {
-                    outputFileName = QFileInfo(inputFiles[k]).completeBaseName() + "."
+                    outputFileName = QFileInfo(inputFile).completeBaseName() + "."
                                      + taskList[i]->getAnswerFileExtension();
                 }
                 if (taskList[i]->getComparisonMode() == Task::LineByLineMode) {
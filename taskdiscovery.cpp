@@ -0,0 +1,199 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "taskdiscovery.h"
+#include "gziputil.h"
+#include "datagenerator.h"
+
+class TaskDiscoveryThread : public QThread
+{
+public:
+    TaskDiscoveryThread(TaskDiscovery*);
+
+protected:
+    void run();
+
+private:
+    TaskDiscovery *discovery;
+};
+
+TaskDiscoveryThread::TaskDiscoveryThread(TaskDiscovery *_discovery)
+{
+    discovery = _discovery;
+}
+
+void TaskDiscoveryThread::run()
+{
+    while (true) {
+        discovery->mutex.lock();
+        if (discovery->cancelled || discovery->next >= discovery->directories.size()) {
+            discovery->mutex.unlock();
+            return;
+        }
+        int index = discovery->next ++;
+        discovery->mutex.unlock();
+        
+        discovery->discover(index);
+        QMetaObject::invokeMethod(discovery, "directoryFinished", Qt::QueuedConnection, Q_ARG(int, index));
+    }
+}
+
+TaskDiscovery::TaskDiscovery(QObject *parent) :
+    QObject(parent)
+{
+    next = 0;
+    finishedCount = 0;
+    cancelled = false;
+}
+
+TaskDiscovery::~TaskDiscovery()
+{
+    stop();
+}
+
+void TaskDiscovery::start(const QString &path, const QStringList &dirs,
+                          const QStringList &_inputFilters, const QStringList &_outputFilters)
+{
+    stop();
+    dataPath = path;
+    directories = dirs;
+    inputFilters = _inputFilters;
+    outputFilters = _outputFilters;
+    results.clear();
+    results.resize(directories.size());
+    next = 0;
+    finishedCount = 0;
+    cancelled = false;
+    
+    if (directories.isEmpty()) {
+        emit finished();
+        return;
+    }
+    
+    int threadCount = qMin(directories.size(), qMax(4, QThread::idealThreadCount()));
+    for (int i = 0; i < threadCount; i ++) {
+        threads.append(new TaskDiscoveryThread(this));
+        threads[i]->start();
+    }
+}
+
+void TaskDiscovery::stop()
+{
+    mutex.lock();
+    cancelled = true;
+    mutex.unlock();
+    for (int i = 0; i < threads.size(); i ++) {
+        threads[i]->wait();
+        delete threads[i];
+    }
+    threads.clear();
+}
+
+bool TaskDiscovery::isFinished() const
+{
+    return finishedCount == directories.size();
+}
+
+int TaskDiscovery::indexOf(const QString &name) const
+{
+    return directories.indexOf(name);
+}
+
+QList< QPair<QString, QString> > TaskDiscovery::getTestCases(const QString &name) const
+{
+    int index = directories.indexOf(name);
+    if (index == -1) return QList< QPair<QString, QString> >();
+    QMutexLocker locker(&mutex);
+    return results[index];
+}
+
+QString TaskDiscovery::naturalSortKey(const QString &name)
+{
+    QString key;
+    key.reserve(name.length() * 2);
+    for (int i = 0; i < name.length(); ) {
+        if (name[i].isDigit()) {
+            int j = i;
+            while (j < name.length() && name[j].isDigit()) j ++;
+            int k = i;
+            while (k + 1 < j && name[k] == '0') k ++;
+            key += QString(20 - qMin(20, j - k), '0');
+            key += name.mid(k, j - k);
+            i = j;
+        } else {
+            key += name[i].toLower();
+            i ++;
+        }
+    }
+    return key;
+}
+
+void TaskDiscovery::discover(int index)
+{
+    QString path = dataPath + directories[index];
+    QMap<QString, QString> inputFiles, outputFiles;
+    getFiles(path, inputFilters, inputFiles);
+    getFiles(path, outputFilters, outputFiles);
+    
+    QList< QPair<QString, QPair<QString, QString> > > keyedCases;
+    QMap<QString, QString>::const_iterator iter;
+    for (iter = inputFiles.constBegin(); iter != inputFiles.constEnd(); ++ iter) {
+        if (outputFiles.contains(iter.key())) {
+            keyedCases.append(qMakePair(naturalSortKey(iter.value()) + QChar(0) + iter.value(),
+                                        qMakePair(iter.value(), outputFiles.value(iter.key()))));
+        }
+    }
+    qSort(keyedCases);
+    
+    QList< QPair<QString, QString> > cases;
+    for (int i = 0; i < keyedCases.size(); i ++) {
+        cases.append(keyedCases[i].second);
+    }
+    
+    QMutexLocker locker(&mutex);
+    results[index] = cases;
+}
+
+void TaskDiscovery::getFiles(const QString &path, const QStringList &filters, QMap<QString, QString> &files)
+{
+    QDir dir(path);
+    if (! filters.isEmpty()) {
+        QStringList nameFilters = filters;
+        for (int i = 0; i < filters.size(); i ++) {
+            nameFilters.append(filters[i] + ".gz");
+            nameFilters.append(filters[i] + ".gen");
+        }
+        dir.setNameFilters(nameFilters);
+    }
+    QFileInfoList list = dir.entryInfoList(QDir::Files);
+    for (int i = 0; i < list.size(); i ++) {
+        QString fileName = QFileInfo(DataGenerator::generatedName(list[i].filePath())).fileName();
+        fileName = GzipUtil::uncompressedName(fileName);
+        QString baseName = QFileInfo(fileName).completeBaseName();
+        files.insert(baseName, list[i].fileName());
+    }
+}
+
+void TaskDiscovery::directoryFinished(int index)
+{
+    finishedCount ++;
+    mutex.lock();
+    bool found = ! results[index].isEmpty();
+    mutex.unlock();
+    if (found) emit taskFound(directories[index]);
+    if (finishedCount == directories.size()) emit finished();
+}
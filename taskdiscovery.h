@@ -0,0 +1,62 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef TASKDISCOVERY_H
+#define TASKDISCOVERY_H
+
+#include <QtCore>
+#include <QObject>
+
+class TaskDiscoveryThread;
+
+class TaskDiscovery : public QObject
+{
+    Q_OBJECT
+    friend class TaskDiscoveryThread;
+public:
+    explicit TaskDiscovery(QObject *parent = 0);
+    ~TaskDiscovery();
+    void start(const QString&, const QStringList&, const QStringList&, const QStringList&);
+    void stop();
+    bool isFinished() const;
+    int indexOf(const QString&) const;
+    QList< QPair<QString, QString> > getTestCases(const QString&) const;
+    static QString naturalSortKey(const QString&);
+
+private:
+    QList<TaskDiscoveryThread*> threads;
+    QString dataPath;
+    QStringList directories;
+    QStringList inputFilters;
+    QStringList outputFilters;
+    QVector< QList< QPair<QString, QString> > > results;
+    mutable QMutex mutex;
+    int next;
+    int finishedCount;
+    bool cancelled;
+    void discover(int);
+    static void getFiles(const QString&, const QStringList&, QMap<QString, QString>&);
+
+private slots:
+    void directoryFinished(int);
+
+signals:
+    void taskFound(const QString&);
+    void finished();
+};
+
+#endif // TASKDISCOVERY_H
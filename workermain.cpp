@@ -0,0 +1,45 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include <QtCore>
+#include "judgingworker.h"
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    
+    QString serverName;
+    int index = 0;
+    int node = -1;
+    QStringList arguments = a.arguments();
+    for (int i = 1; i + 1 < arguments.size(); i += 2) {
+        if (arguments[i] == "--server") serverName = arguments[i + 1];
+        if (arguments[i] == "--index") index = arguments[i + 1].toInt();
+        if (arguments[i] == "--node") node = arguments[i + 1].toInt();
+    }
+    if (serverName.isEmpty()) {
+        QTextStream(stderr) << "lemon-worker is started by lemon or lemon-cli and cannot be used alone\n";
+        return 1;
+    }
+    
+    if (node >= 0) JudgingWorker::bindToNode(node);
+    
+    JudgingWorker worker;
+    if (! worker.connectToServer(serverName, index)) return 1;
+    return a.exec();
+}
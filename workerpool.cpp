@@ -0,0 +1,301 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#include "workerpool.h"
+#include "judgingjob.h"
+#include <QLocalServer>
+#include <QLocalSocket>
+
+static const int maxCrashCount = 5;
+static const int maxAttempts = 3;
+
+WorkerPool::WorkerPool(QObject *parent) :
+    QObject(parent)
+{
+    server = 0;
+    nextJobId = 0;
+}
+
+WorkerPool::~WorkerPool()
+{
+    stop();
+}
+
+bool WorkerPool::start(int number)
+{
+    stop();
+    if (number <= 0 || ! QFileInfo(workerProgram()).isExecutable()) return false;
+    
+    server = new QLocalServer(this);
+    QString name = QString("lemon-%1-%2").arg(QCoreApplication::applicationPid()).arg(qrand());
+    QLocalServer::removeServer(name);
+    if (! server->listen(name)) {
+        delete server;
+        server = 0;
+        return false;
+    }
+    connect(server, SIGNAL(newConnection()), this, SLOT(newConnection()));
+    
+    for (int i = 0; i < number; i ++) {
+        Worker *worker = new Worker;
+        worker->index = i;
+        worker->process = 0;
+        worker->socket = 0;
+        worker->crashCount = 0;
+        workers.append(worker);
+        startWorker(worker);
+    }
+    return true;
+}
+
+void WorkerPool::stop()
+{
+    for (int i = 0; i < workers.size(); i ++) {
+        if (workers[i]->process) {
+            workers[i]->process->disconnect(this);
+            workers[i]->process->kill();
+            workers[i]->process->waitForFinished();
+            delete workers[i]->process;
+        }
+        delete workers[i];
+    }
+    workers.clear();
+    buffers.clear();
+    
+    if (server) {
+        QList<QLocalSocket*> sockets = server->findChildren<QLocalSocket*>();
+        for (int i = 0; i < sockets.size(); i ++) {
+            sockets[i]->disconnect(this);
+        }
+        delete server;
+        server = 0;
+    }
+    
+    QList<qint64> ids = jobs.keys();
+    for (int i = 0; i < ids.size(); i ++) {
+        finishJob(ids[i], QByteArray());
+    }
+}
+
+bool WorkerPool::isRunning() const
+{
+    return server != 0;
+}
+
+int WorkerPool::getNumberOfWorkers() const
+{
+    return workers.size();
+}
+
+QString WorkerPool::workerProgram()
+{
+#ifdef Q_OS_WIN32
+    return QCoreApplication::applicationDirPath() + "/lemon-worker.exe";
+#else
+    return QCoreApplication::applicationDirPath() + "/lemon-worker";
+#endif
+}
+
+int WorkerPool::numberOfNodes()
+{
+#ifdef Q_OS_LINUX
+    QStringList nodes = QDir("/sys/devices/system/node").entryList(QStringList("node*"), QDir::Dirs);
+    int count = nodes.filter(QRegExp("^node\\d+$")).size();
+    if (count > 0) return count;
+#endif
+    return 1;
+}
+
+void WorkerPool::startWorker(Worker *worker)
+{
+    worker->process = new QProcess(this);
+    worker->process->setProcessChannelMode(QProcess::ForwardedChannels);
+    connect(worker->process, SIGNAL(finished(int, QProcess::ExitStatus)), this, SLOT(workerFinished()));
+    connect(worker->process, SIGNAL(error(QProcess::ProcessError)),
+            this, SLOT(workerError(QProcess::ProcessError)));
+    QStringList arguments;
+    arguments << "--server" << server->serverName();
+    arguments << "--index" << QString::number(worker->index);
+    arguments << "--node" << QString::number(worker->index % numberOfNodes());
+    worker->process->start(workerProgram(), arguments);
+}
+
+void WorkerPool::dispatch()
+{
+    while (! pendingJobs.isEmpty()) {
+        Worker *target = 0;
+        for (int i = 0; i < workers.size(); i ++) {
+            if (! workers[i]->socket) continue;
+            if (! target || workers[i]->inFlight.size() < target->inFlight.size()) target = workers[i];
+        }
+        if (! target) return;
+        qint64 id = pendingJobs.takeFirst();
+        target->inFlight.append(id);
+        JudgingJob::writeMessage(target->socket, JudgingJob::JobMessage, id, jobs[id].data);
+    }
+}
+
+void WorkerPool::requeue(Worker *worker)
+{
+    for (int i = worker->inFlight.size() - 1; i >= 0; i --) {
+        qint64 id = worker->inFlight[i];
+        if (! jobs.contains(id)) continue;
+        if (++ jobs[id].attempts >= maxAttempts) {
+            finishJob(id, QByteArray());
+        } else {
+            pendingJobs.prepend(id);
+        }
+    }
+    worker->inFlight.clear();
+    
+    if (worker->socket) {
+        buffers.remove(worker->socket);
+        worker->socket->disconnect(this);
+        worker->socket->deleteLater();
+        worker->socket = 0;
+    }
+}
+
+void WorkerPool::finishJob(qint64 id, const QByteArray &data)
+{
+    if (! jobs.contains(id)) return;
+    Job job = jobs.take(id);
+    pendingJobs.removeAll(id);
+    if (job.owner) {
+        QMetaObject::invokeMethod(job.owner, "remoteJobFinished", Qt::QueuedConnection,
+                                  Q_ARG(qint64, job.ownerJobId), Q_ARG(QByteArray, data));
+    }
+}
+
+void WorkerPool::failPendingJobsIfStalled()
+{
+    for (int i = 0; i < workers.size(); i ++) {
+        if (workers[i]->process) return;
+    }
+    
+    QList<qint64> ids = jobs.keys();
+    for (int i = 0; i < ids.size(); i ++) {
+        finishJob(ids[i], QByteArray());
+    }
+}
+
+WorkerPool::Worker* WorkerPool::findWorker(QObject *object) const
+{
+    if (! object) return 0;
+    for (int i = 0; i < workers.size(); i ++) {
+        if (workers[i]->process == object || workers[i]->socket == object) return workers[i];
+    }
+    return 0;
+}
+
+void WorkerPool::newConnection()
+{
+    while (server->hasPendingConnections()) {
+        QLocalSocket *socket = server->nextPendingConnection();
+        buffers[socket] = QByteArray();
+        connect(socket, SIGNAL(readyRead()), this, SLOT(readyRead()));
+        connect(socket, SIGNAL(disconnected()), this, SLOT(socketDisconnected()));
+    }
+}
+
+void WorkerPool::readyRead()
+{
+    QLocalSocket *socket = qobject_cast<QLocalSocket*>(sender());
+    if (! socket || ! buffers.contains(socket)) return;
+    buffers[socket].append(socket->readAll());
+    
+    JudgingJob::MessageType type;
+    qint64 id;
+    QByteArray payload;
+    while (JudgingJob::readMessage(buffers[socket], type, id, payload)) {
+        if (type == JudgingJob::HelloMessage) {
+            if (0 <= id && id < workers.size() && ! workers[id]->socket) {
+                workers[id]->socket = socket;
+            }
+        }
+        if (type == JudgingJob::ResultMessage) {
+            Worker *worker = findWorker(socket);
+            if (worker) {
+                worker->inFlight.removeAll(id);
+                worker->crashCount = 0;
+            }
+            finishJob(id, payload);
+        }
+    }
+    
+    dispatch();
+}
+
+void WorkerPool::socketDisconnected()
+{
+    QLocalSocket *socket = qobject_cast<QLocalSocket*>(sender());
+    if (! socket) return;
+    Worker *worker = findWorker(socket);
+    if (worker) {
+        requeue(worker);
+        if (worker->process) worker->process->kill();
+    } else {
+        buffers.remove(socket);
+        socket->deleteLater();
+    }
+}
+
+void WorkerPool::workerFinished()
+{
+    Worker *worker = findWorker(sender());
+    if (! worker) return;
+    requeue(worker);
+    worker->process->deleteLater();
+    worker->process = 0;
+    if (++ worker->crashCount <= maxCrashCount) startWorker(worker);
+    dispatch();
+    failPendingJobsIfStalled();
+}
+
+void WorkerPool::workerError(QProcess::ProcessError error)
+{
+    if (error == QProcess::FailedToStart) workerFinished();
+}
+
+void WorkerPool::submitJob(QObject *owner, qint64 ownerJobId, const QByteArray &data)
+{
+    Job job;
+    job.owner = owner;
+    job.ownerJobId = ownerJobId;
+    job.data = data;
+    job.attempts = 0;
+    jobs[nextJobId] = job;
+    pendingJobs.append(nextJobId ++);
+    dispatch();
+    failPendingJobsIfStalled();
+}
+
+void WorkerPool::cancelJobs(QObject *owner)
+{
+    QList<qint64> ids = jobs.keys();
+    for (int i = 0; i < ids.size(); i ++) {
+        if (jobs[ids[i]].owner != owner) continue;
+        jobs.remove(ids[i]);
+        pendingJobs.removeAll(ids[i]);
+        for (int j = 0; j < workers.size(); j ++) {
+            if (workers[j]->inFlight.removeAll(ids[i]) > 0 && workers[j]->socket) {
+                JudgingJob::writeMessage(workers[j]->socket, JudgingJob::CancelMessage, ids[i], QByteArray());
+            }
+        }
+    }
+}
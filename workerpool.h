@@ -0,0 +1,83 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <QtCore>
+#include <QObject>
+#include <QPointer>
+
+class QLocalServer;
+class QLocalSocket;
+
+class WorkerPool : public QObject
+{
+    Q_OBJECT
+public:
+    explicit WorkerPool(QObject *parent = 0);
+    ~WorkerPool();
+    bool start(int);
+    void stop();
+    bool isRunning() const;
+    int getNumberOfWorkers() const;
+    static QString workerProgram();
+    static int numberOfNodes();
+
+private:
+    struct Job
+    {
+        QPointer<QObject> owner;
+        qint64 ownerJobId;
+        QByteArray data;
+        int attempts;
+    };
+    struct Worker
+    {
+        int index;
+        QProcess *process;
+        QLocalSocket *socket;
+        QList<qint64> inFlight;
+        int crashCount;
+    };
+    QLocalServer *server;
+    QList<Worker*> workers;
+    QMap<QLocalSocket*, QByteArray> buffers;
+    QMap<qint64, Job> jobs;
+    QList<qint64> pendingJobs;
+    qint64 nextJobId;
+    void startWorker(Worker*);
+    void dispatch();
+    void requeue(Worker*);
+    void finishJob(qint64, const QByteArray&);
+    void failPendingJobsIfStalled();
+    Worker* findWorker(QObject*) const;
+
+private slots:
+    void newConnection();
+    void readyRead();
+    void socketDisconnected();
+    void workerFinished();
+    void workerError(QProcess::ProcessError);
+
+public slots:
+    void submitJob(QObject*, qint64, const QByteArray&);
+    void cancelJobs(QObject*);
+};
+
+#endif // WORKERPOOL_H
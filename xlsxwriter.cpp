@@ -0,0 +1,318 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#include "xlsxwriter.h"
+
+static const int sheetBufferSize = 1 << 16;
+static const qint64 maxDeflateSize = 32 << 20;
+
+XlsxWriter::XlsxWriter()
+{
+    sheetFile = 0;
+    sheetCrc = 0;
+    sheetSize = 0;
+    rowCount = 0;
+    dosTime = 0;
+    dosDate = 0;
+    failed = false;
+}
+
+XlsxWriter::~XlsxWriter()
+{
+    if (sheetFile) delete sheetFile;
+}
+
+bool XlsxWriter::open(const QString &fileName)
+{
+    zipFile.setFileName(fileName);
+    if (! zipFile.open(QFile::WriteOnly | QFile::Truncate)) return false;
+    
+    QDateTime now = QDateTime::currentDateTime();
+    dosTime = quint16((now.time().hour() << 11) | (now.time().minute() << 5) | (now.time().second() / 2));
+    dosDate = quint16(((now.date().year() - 1980) << 9) | (now.date().month() << 5) | now.date().day());
+    entries.clear();
+    sheetNames.clear();
+    failed = false;
+    return true;
+}
+
+bool XlsxWriter::beginSheet(const QString &name)
+{
+    if (sheetFile) endSheet();
+    sheetFile = new QTemporaryFile();
+    if (! sheetFile->open()) {
+        delete sheetFile;
+        sheetFile = 0;
+        failed = true;
+        return false;
+    }
+    
+    sheetNames.append(sheetName(name, sheetNames));
+    sheetCrc = 0;
+    sheetSize = 0;
+    rowCount = 0;
+    buffer.clear();
+    buffer.reserve(sheetBufferSize + 4096);
+    buffer += "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n";
+    buffer += "<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\"><sheetData>";
+    return true;
+}
+
+void XlsxWriter::writeRow(const QVariantList &row)
+{
+    if (! sheetFile) return;
+    
+    buffer += "<row r=\"";
+    buffer += QByteArray::number(++ rowCount);
+    buffer += "\">";
+    for (int i = 0; i < row.size(); i ++) {
+        switch (row[i].type()) {
+            case QVariant::Invalid:
+                buffer += "<c/>";
+                break;
+            case QVariant::Int:
+            case QVariant::UInt:
+            case QVariant::LongLong:
+            case QVariant::ULongLong:
+                buffer += "<c><v>";
+                buffer += QByteArray::number(row[i].toLongLong());
+                buffer += "</v></c>";
+                break;
+            case QVariant::Double:
+                buffer += "<c><v>";
+                buffer += QByteArray::number(row[i].toDouble(), 'g', 15);
+                buffer += "</v></c>";
+                break;
+            default:
+                buffer += "<c t=\"inlineStr\"><is><t>";
+                appendEscaped(buffer, row[i].toString());
+                buffer += "</t></is></c>";
+                break;
+        }
+    }
+    buffer += "</row>";
+    if (buffer.size() >= sheetBufferSize) flushBuffer();
+}
+
+bool XlsxWriter::endSheet()
+{
+    if (! sheetFile) return false;
+    
+    buffer += "</sheetData></worksheet>";
+    flushBuffer();
+    sheetFile->seek(0);
+    bool done = writeEntry(QString("xl/worksheets/sheet%1.xml").arg(sheetNames.size()),
+                           sheetFile, sheetCrc, sheetSize);
+    delete sheetFile;
+    sheetFile = 0;
+    if (! done) failed = true;
+    return done;
+}
+
+bool XlsxWriter::close()
+{
+    if (sheetFile) endSheet();
+    
+    QByteArray contentTypes;
+    contentTypes += "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n";
+    contentTypes += "<Types xmlns=\"http://schemas.openxmlformats.org/package/2006/content-types\">";
+    contentTypes += "<Default Extension=\"rels\" ContentType=\"application/vnd.openxmlformats-package.relationships+xml\"/>";
+    contentTypes += "<Default Extension=\"xml\" ContentType=\"application/xml\"/>";
+    contentTypes += "<Override PartName=\"/xl/workbook.xml\" "
+                    "ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet.main+xml\"/>";
+    for (int i = 0; i < sheetNames.size(); i ++) {
+        contentTypes += QString("<Override PartName=\"/xl/worksheets/sheet%1.xml\" ").arg(i + 1).toUtf8();
+        contentTypes += "ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml\"/>";
+    }
+    contentTypes += "</Types>";
+    
+    QByteArray rootRels;
+    rootRels += "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n";
+    rootRels += "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">";
+    rootRels += "<Relationship Id=\"rId1\" "
+                "Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/officeDocument\" "
+                "Target=\"xl/workbook.xml\"/>";
+    rootRels += "</Relationships>";
+    
+    QByteArray workbook;
+    workbook += "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n";
+    workbook += "<workbook xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\" "
+                "xmlns:r=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships\"><sheets>";
+    for (int i = 0; i < sheetNames.size(); i ++) {
+        workbook += "<sheet name=\"";
+        appendEscaped(workbook, sheetNames[i]);
+        workbook += QString("\" sheetId=\"%1\" r:id=\"rId%1\"/>").arg(i + 1).toUtf8();
+    }
+    workbook += "</sheets></workbook>";
+    
+    QByteArray workbookRels;
+    workbookRels += "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n";
+    workbookRels += "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">";
+    for (int i = 0; i < sheetNames.size(); i ++) {
+        workbookRels += QString("<Relationship Id=\"rId%1\" "
+                                "Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet\" "
+                                "Target=\"worksheets/sheet%1.xml\"/>").arg(i + 1).toUtf8();
+    }
+    workbookRels += "</Relationships>";
+    
+    if (! writeEntry("[Content_Types].xml", contentTypes)) failed = true;
+    if (! writeEntry("_rels/.rels", rootRels)) failed = true;
+    if (! writeEntry("xl/workbook.xml", workbook)) failed = true;
+    if (! writeEntry("xl/_rels/workbook.xml.rels", workbookRels)) failed = true;
+    if (! writeCentralDirectory()) failed = true;
+    zipFile.close();
+    return ! failed;
+}
+
+void XlsxWriter::flushBuffer()
+{
+    if (buffer.isEmpty()) return;
+    sheetCrc = updateCrc(sheetCrc, buffer.constData(), buffer.size());
+    sheetSize += buffer.size();
+    if (sheetFile->write(buffer) != buffer.size()) failed = true;
+    buffer.clear();
+}
+
+bool XlsxWriter::writeEntry(const QString &name, const QByteArray &data)
+{
+    QBuffer device;
+    device.setData(data);
+    device.open(QBuffer::ReadOnly);
+    return writeEntry(name, &device, updateCrc(0, data.constData(), data.size()), data.size());
+}
+
+bool XlsxWriter::writeEntry(const QString &name, QIODevice *device, quint32 crc, qint64 size)
+{
+    ZipEntry entry;
+    entry.name = name.toUtf8();
+    entry.crc = crc;
+    entry.size = quint32(size);
+    entry.offset = quint32(zipFile.pos());
+    
+    if (size > 0 && size <= maxDeflateSize) {
+        QByteArray compressed = qCompress(device->readAll(), 6);
+        entry.method = 8;
+        entry.compressedSize = quint32(compressed.size() - 10);
+        if (! writeLocalHeader(entry)) return false;
+        if (zipFile.write(compressed.constData() + 6, entry.compressedSize) != qint64(entry.compressedSize)) return false;
+    } else {
+        entry.method = 0;
+        entry.compressedSize = entry.size;
+        if (! writeLocalHeader(entry)) return false;
+        while (! device->atEnd()) {
+            QByteArray block = device->read(sheetBufferSize);
+            if (block.isEmpty() || zipFile.write(block) != block.size()) return false;
+        }
+    }
+    
+    entries.append(entry);
+    return true;
+}
+
+bool XlsxWriter::writeLocalHeader(ZipEntry &entry)
+{
+    QByteArray header;
+    QDataStream out(&header, QIODevice::WriteOnly);
+    out.setByteOrder(QDataStream::LittleEndian);
+    out << quint32(0x04034b50) << quint16(20) << quint16(0x0800) << entry.method;
+    out << dosTime << dosDate << entry.crc << entry.compressedSize << entry.size;
+    out << quint16(entry.name.size()) << quint16(0);
+    header += entry.name;
+    return zipFile.write(header) == header.size();
+}
+
+bool XlsxWriter::writeCentralDirectory()
+{
+    quint32 offset = quint32(zipFile.pos());
+    QByteArray directory;
+    QDataStream out(&directory, QIODevice::WriteOnly);
+    out.setByteOrder(QDataStream::LittleEndian);
+    for (int i = 0; i < entries.size(); i ++) {
+        const ZipEntry &entry = entries[i];
+        out << quint32(0x02014b50) << quint16(20) << quint16(20) << quint16(0x0800) << entry.method;
+        out << dosTime << dosDate << entry.crc << entry.compressedSize << entry.size;
+        out << quint16(entry.name.size()) << quint16(0) << quint16(0) << quint16(0) << quint16(0);
+        out << quint32(0) << entry.offset;
+        out.writeRawData(entry.name.constData(), entry.name.size());
+    }
+    quint32 size = quint32(directory.size());
+    out << quint32(0x06054b50) << quint16(0) << quint16(0);
+    out << quint16(entries.size()) << quint16(entries.size()) << size << offset << quint16(0);
+    return zipFile.write(directory) == directory.size();
+}
+
+quint32 XlsxWriter::updateCrc(quint32 crc, const char *data, int length)
+{
+    static quint32 table[256];
+    static bool initialized = false;
+    if (! initialized) {
+        for (quint32 i = 0; i < 256; i ++) {
+            quint32 value = i;
+            for (int j = 0; j < 8; j ++) {
+                value = (value & 1) ? (0xedb88320u ^ (value >> 1)) : (value >> 1);
+            }
+            table[i] = value;
+        }
+        initialized = true;
+    }
+    
+    crc = ~ crc;
+    for (int i = 0; i < length; i ++) {
+        crc = table[(crc ^ quint8(data[i])) & 0xff] ^ (crc >> 8);
+    }
+    return ~ crc;
+}
+
+void XlsxWriter::appendEscaped(QByteArray &out, const QString &text)
+{
+    QByteArray data = text.toUtf8();
+    for (int i = 0; i < data.size(); i ++) {
+        char ch = data[i];
+        switch (ch) {
+            case '&':
+                out += "&amp;";
+                break;
+            case '<':
+                out += "&lt;";
+                break;
+            case '>':
+                out += "&gt;";
+                break;
+            case '"':
+                out += "&quot;";
+                break;
+            default:
+                if (quint8(ch) >= 0x20 || ch == '\t' || ch == '\n' || ch == '\r') out += ch;
+                break;
+        }
+    }
+}
+
+QString XlsxWriter::sheetName(const QString &name, const QStringList &usedNames)
+{
+    QString result = name;
+    result.replace(QRegExp("[\\[\\]:*?/\\\\]"), "_");
+    result = result.left(31);
+    if (result.isEmpty()) result = "Sheet";
+    
+    QString candidate = result;
+    for (int i = 2; usedNames.contains(candidate, Qt::CaseInsensitive); i ++) {
+        QString suffix = QString(" (%1)").arg(i);
+        candidate = result.left(31 - suffix.length()) + suffix;
+    }
+    return candidate;
+}
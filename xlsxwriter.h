@@ -0,0 +1,65 @@
+/***************************************************************************
+    This file is part of Project Lemon
+    Copyright (C) 2011 Zhipeng Jia
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+***************************************************************************/
+#ifndef XLSXWRITER_H
+#define XLSXWRITER_H
+
+#include <QtCore>
+
+class XlsxWriter
+{
+public:
+    XlsxWriter();
+    ~XlsxWriter();
+    bool open(const QString&);
+    bool beginSheet(const QString&);
+    void writeRow(const QVariantList&);
+    bool endSheet();
+    bool close();
+
+private:
+    struct ZipEntry {
+        QByteArray name;
+        quint16 method;
+        quint32 crc;
+        quint32 compressedSize;
+        quint32 size;
+        quint32 offset;
+    };
+    
+    QFile zipFile;
+    QTemporaryFile *sheetFile;
+    QStringList sheetNames;
+    QList<ZipEntry> entries;
+    QByteArray buffer;
+    quint32 sheetCrc;
+    qint64 sheetSize;
+    int rowCount;
+    quint16 dosTime;
+    quint16 dosDate;
+    bool failed;
+    void flushBuffer();
+    bool writeEntry(const QString&, const QByteArray&);
+    bool writeEntry(const QString&, QIODevice*, quint32, qint64);
+    bool writeLocalHeader(ZipEntry&);
+    bool writeCentralDirectory();
+    static quint32 updateCrc(quint32, const char*, int);
+    static void appendEscaped(QByteArray&, const QString&);
+    static QString sheetName(const QString&, const QStringList&);
+};
+
+#endif // XLSXWRITER_H